@@ -0,0 +1,251 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameOptionsBatch.h"
+
+#include "EdGraphSchema_K2.h"
+#include "ScopedTransaction.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "RowNameSource/RowNameInheritance.h"
+
+bool EasyDataTableRowName::Editor::CanVariableUseOptionsSlot(const FBPVariableDescription& Variable,
+	ERowNameOptionsSlot Slot)
+{
+	const FEdGraphPinType& PinType = Variable.VarType;
+	switch (Slot)
+	{
+	case ERowNameOptionsSlot::Common:
+		return PinType.PinCategory == UEdGraphSchema_K2::PC_Name && !PinType.IsMap();
+	case ERowNameOptionsSlot::Key:
+		return PinType.PinCategory == UEdGraphSchema_K2::PC_Name && PinType.IsMap();
+	case ERowNameOptionsSlot::Value:
+		return PinType.IsMap() && PinType.PinValueType.TerminalCategory == UEdGraphSchema_K2::PC_Name;
+	}
+	return false;
+}
+
+bool EasyDataTableRowName::Editor::FRowNameOptionsBatch::Assign(UBlueprint* Blueprint, const FName& VariableName,
+	ERowNameOptionsSlot Slot, const FSoftObjectPath& SourcePath)
+{
+	if(!IsValid(Blueprint))
+	{
+		return false;
+	}
+	if(!ResolveRequestProvider(SourcePath))
+	{
+		return false;
+	}
+	FRequest& Request = Requests.FindOrAdd(Blueprint).AddDefaulted_GetRef();
+	Request.VariableName = VariableName;
+	Request.Slot = Slot;
+	Request.SourcePath = SourcePath;
+	return true;
+}
+
+bool EasyDataTableRowName::Editor::FRowNameOptionsBatch::Retarget(UBlueprint* Blueprint,
+	const FSoftObjectPath& OldSourcePath, const FSoftObjectPath& NewSourcePath)
+{
+	if(!IsValid(Blueprint) || OldSourcePath.IsNull() || OldSourcePath == NewSourcePath)
+	{
+		return false;
+	}
+	if(!ResolveRequestProvider(NewSourcePath))
+	{
+		return false;
+	}
+	FRequest& Request = Requests.FindOrAdd(Blueprint).AddDefaulted_GetRef();
+	Request.SourcePath = NewSourcePath;
+	Request.OldSourcePath = OldSourcePath;
+	Request.bRetarget = true;
+	return true;
+}
+
+bool EasyDataTableRowName::Editor::FRowNameOptionsBatch::ResolveRequestProvider(const FSoftObjectPath& SourcePath)
+{
+	if(SourcePath.IsNull() || ProviderByPath.Contains(SourcePath))
+	{
+		return true;
+	}
+	TSharedPtr<const FRowNameSourceProvider> Provider = FRowNameSourceProviderRegistry::Get().FindProviderForPath(SourcePath);
+	if(!Provider.IsValid())
+	{
+		// Clearing the existing keys here would silently wipe the metadata of every matching variable
+		UE_LOG(LogEasyDataTableRowName, Warning, TEXT("%s is not a row name source asset, the request is skipped"), *SourcePath.ToString());
+		++NumRejected;
+		return false;
+	}
+	ProviderByPath.Add(SourcePath, MoveTemp(Provider));
+	return true;
+}
+
+int32 EasyDataTableRowName::Editor::FRowNameOptionsBatch::Apply(const FText& TransactionText, bool bCompile)
+{
+	check(IsInGameThread());
+
+	TArray<FBlueprintPlan> Plans;
+	Plans.Reserve(Requests.Num());
+	for (TPair<TWeakObjectPtr<UBlueprint>, TArray<FRequest>>& Pair : Requests)
+	{
+		if(UBlueprint* Blueprint = Pair.Key.Get())
+		{
+			FBlueprintPlan& Plan = Plans.AddDefaulted_GetRef();
+			Plan.Blueprint = Blueprint;
+			Plan.Requests = MoveTemp(Pair.Value);
+		}
+	}
+	Requests.Reset();
+
+	// Planning only reads variable descriptions, the game thread waits here so nothing gets collected
+	ParallelFor(Plans.Num(), [this, &Plans](int32 PlanIndex)
+	{
+		PlanBlueprint(Plans[PlanIndex]);
+	});
+
+	const bool bHasEdits = Plans.ContainsByPredicate([](const FBlueprintPlan& Plan)
+	{
+		return !Plan.Edits.IsEmpty();
+	});
+	if(!bHasEdits)
+	{
+		ProviderByPath.Reset();
+		return 0;
+	}
+
+	int32 NumChangedVariables = 0;
+	bool bCompiledAny = false;
+	{
+		const FScopedTransaction Transaction(TransactionText);
+		for (const FBlueprintPlan& Plan : Plans)
+		{
+			const int32 NumChanged = ApplyPlan(Plan, bCompile);
+			NumChangedVariables += NumChanged;
+			bCompiledAny |= bCompile && NumChanged > 0;
+		}
+	}
+
+	if(bCompiledAny)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+	ProviderByPath.Reset();
+	return NumChangedVariables;
+}
+
+void EasyDataTableRowName::Editor::FRowNameOptionsBatch::PlanBlueprint(FBlueprintPlan& Plan) const
+{
+	const TArray<FBPVariableDescription>& Variables = Plan.Blueprint->NewVariables;
+	for (const FRequest& Request : Plan.Requests)
+	{
+		for (int32 VariableIndex = 0; VariableIndex < Variables.Num(); ++VariableIndex)
+		{
+			const FBPVariableDescription& Variable = Variables[VariableIndex];
+			if(Request.bRetarget)
+			{
+				const FString OldPathString = Request.OldSourcePath.ToString();
+				for (const ERowNameOptionsSlot Slot : {ERowNameOptionsSlot::Common, ERowNameOptionsSlot::Key, ERowNameOptionsSlot::Value})
+				{
+					for (const TSharedRef<FRowNameSourceProvider>& Provider : FRowNameSourceProviderRegistry::Get().GetProviders())
+					{
+						const FName& MetaDataKey = Provider->GetMetaDataKey(Slot);
+						if(Variable.HasMetaData(MetaDataKey) && Variable.GetMetaData(MetaDataKey) == OldPathString)
+						{
+							PlanSlot(Plan, VariableIndex, Slot, Request.SourcePath, Plan.Edits);
+							break;
+						}
+					}
+				}
+			}
+			else if((Request.VariableName.IsNone() || Request.VariableName == Variable.VarName)
+				&& CanVariableUseOptionsSlot(Variable, Request.Slot))
+			{
+				PlanSlot(Plan, VariableIndex, Request.Slot, Request.SourcePath, Plan.Edits);
+			}
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameOptionsBatch::PlanSlot(const FBlueprintPlan& Plan, int32 VariableIndex,
+	ERowNameOptionsSlot Slot, const FSoftObjectPath& SourcePath, TArray<FMetaDataEdit>& OutEdits) const
+{
+	const FBPVariableDescription& Variable = Plan.Blueprint->NewVariables[VariableIndex];
+	const TSharedPtr<const FRowNameSourceProvider>* PathProvider = ProviderByPath.Find(SourcePath);
+	const FString PathString = SourcePath.ToString();
+	// Only a null path clears the slot, requests with an unknown path are rejected before planning
+	if(!SourcePath.IsNull() && (PathProvider == nullptr || !PathProvider->IsValid()))
+	{
+		return;
+	}
+
+	// Only one provider of a slot may carry a path, the one matching the source asset class
+	for (const TSharedRef<FRowNameSourceProvider>& Provider : FRowNameSourceProviderRegistry::Get().GetProviders())
+	{
+		const FName& MetaDataKey = Provider->GetMetaDataKey(Slot);
+		const bool bHasKey = Variable.HasMetaData(MetaDataKey);
+		if(PathProvider != nullptr && *PathProvider == Provider)
+		{
+			if(!bHasKey || Variable.GetMetaData(MetaDataKey) != PathString)
+			{
+				OutEdits.Add({VariableIndex, MetaDataKey, PathString, false});
+			}
+		}
+		else if(bHasKey)
+		{
+			OutEdits.Add({VariableIndex, MetaDataKey, FString(), true});
+		}
+	}
+}
+
+int32 EasyDataTableRowName::Editor::FRowNameOptionsBatch::ApplyPlan(const FBlueprintPlan& Plan, bool bCompile)
+{
+	UBlueprint* Blueprint = Plan.Blueprint;
+	if(!IsValid(Blueprint) || Plan.Edits.IsEmpty())
+	{
+		return 0;
+	}
+
+	Blueprint->Modify();
+	TSet<int32> ChangedVariables;
+	for (const FMetaDataEdit& Edit : Plan.Edits)
+	{
+		FBPVariableDescription& Variable = Blueprint->NewVariables[Edit.VariableIndex];
+		if(Edit.bRemove)
+		{
+			Variable.RemoveMetaData(Edit.Key);
+		}
+		else
+		{
+			Variable.SetMetaData(Edit.Key, Edit.Value);
+		}
+		ChangedVariables.Add(Edit.VariableIndex);
+
+		// Keep the generated properties in sync for editors that read them before the next compile
+		for (UClass* Class : {Blueprint->SkeletonGeneratedClass.Get(), Blueprint->GeneratedClass.Get()})
+		{
+			FProperty* Property = Class != nullptr ? FindFProperty<FProperty>(Class, Variable.VarName) : nullptr;
+			if(Property == nullptr)
+			{
+				continue;
+			}
+			if(Edit.bRemove)
+			{
+				Property->RemoveMetaData(Edit.Key);
+			}
+			else
+			{
+				Property->SetMetaData(Edit.Key, *Edit.Value);
+			}
+		}
+	}
+
+	// Metadata of existing properties changed in place, nothing is replaced that would flush resolved inheritance
+	FRowNameInheritance::Get().ClearCache();
+	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+	if(bCompile)
+	{
+		FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+	}
+	return ChangedVariables.Num();
+}
@@ -0,0 +1,76 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "RowNameSource/RowNameSourceProvider.h"
+
+class UBlueprint;
+struct FBPVariableDescription;
+
+namespace EasyDataTableRowName::Editor
+{
+	/** Slots of a Blueprint variable that can hold a row name source, judged from its pin type */
+	EASYDATATABLEROWNAMEEDITOR_API bool CanVariableUseOptionsSlot(const FBPVariableDescription& Variable, ERowNameOptionsSlot Slot);
+
+	/**
+	 * Collects row name source metadata edits on Blueprint variables and applies them together.
+	 * Edits are planned for all Blueprints in parallel, then written with one transaction for the
+	 * whole batch and one modify / compile per Blueprint, instead of one per variable.
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API FRowNameOptionsBatch
+	{
+		public:
+			/**
+			 * Sets the source of one variable, NAME_None targets every variable the slot fits. A null SourcePath clears
+			 * the slot; a path no provider handles (typo, deleted asset, unsupported class) is rejected and returns false.
+			 */
+			bool Assign(UBlueprint* Blueprint, const FName& VariableName, ERowNameOptionsSlot Slot, const FSoftObjectPath& SourcePath);
+
+			/** Replaces OldSourcePath by NewSourcePath on every variable and slot of Blueprint, rejected like Assign */
+			bool Retarget(UBlueprint* Blueprint, const FSoftObjectPath& OldSourcePath, const FSoftObjectPath& NewSourcePath);
+
+			bool IsEmpty() const { return Requests.IsEmpty(); }
+
+			/** Requests rejected by Assign / Retarget since the batch was created, never counted as changes */
+			int32 GetNumRejected() const { return NumRejected; }
+
+			/** Applies all queued edits, returns the number of variables changed */
+			int32 Apply(const FText& TransactionText, bool bCompile);
+
+		private:
+			struct FRequest
+			{
+				FName VariableName;
+				ERowNameOptionsSlot Slot = ERowNameOptionsSlot::Common;
+				FSoftObjectPath SourcePath;
+				FSoftObjectPath OldSourcePath;
+				bool bRetarget = false;
+			};
+
+			struct FMetaDataEdit
+			{
+				int32 VariableIndex = INDEX_NONE;
+				FName Key;
+				FString Value;
+				bool bRemove = false;
+			};
+
+			struct FBlueprintPlan
+			{
+				/** Resolved on the game thread, garbage collection is deferred until the batch is done */
+				UBlueprint* Blueprint = nullptr;
+				TArray<FRequest> Requests;
+				TArray<FMetaDataEdit> Edits;
+			};
+
+			void PlanBlueprint(FBlueprintPlan& Plan) const;
+			void PlanSlot(const FBlueprintPlan& Plan, int32 VariableIndex, ERowNameOptionsSlot Slot,
+				const FSoftObjectPath& SourcePath, TArray<FMetaDataEdit>& OutEdits) const;
+			static int32 ApplyPlan(const FBlueprintPlan& Plan, bool bCompile);
+			/** Provider of SourcePath for a request, false with a warning when a non-null path has none */
+			bool ResolveRequestProvider(const FSoftObjectPath& SourcePath);
+
+			TMap<TWeakObjectPtr<UBlueprint>, TArray<FRequest>> Requests;
+			TMap<FSoftObjectPath, TSharedPtr<const FRowNameSourceProvider>> ProviderByPath;
+			int32 NumRejected = 0;
+	};
+}
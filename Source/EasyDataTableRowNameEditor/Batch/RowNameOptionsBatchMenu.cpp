@@ -0,0 +1,254 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameOptionsBatchMenu.h"
+
+#include "ContentBrowserMenuContexts.h"
+#include "RowNameOptionsBatch.h"
+#include "ToolMenus.h"
+#include "Customization/DataTableRowNameCustomization.h"
+#include "Engine/Blueprint.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Interfaces/IMainFrameModule.h"
+#include "Misc/MessageDialog.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define LOCTEXT_NAMESPACE "EasyDataTableRowName"
+
+namespace EasyDataTableRowName::Editor
+{
+	static const FName BatchMenuOwnerName(TEXT("EasyDataTableRowNameBatch"));
+}
+
+FDelegateHandle EasyDataTableRowName::Editor::FRowNameOptionsBatchMenu::StartupCallbackHandle;
+
+void EasyDataTableRowName::Editor::FRowNameOptionsBatchMenu::Register()
+{
+	StartupCallbackHandle = UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateStatic(&FRowNameOptionsBatchMenu::RegisterMenus));
+}
+
+void EasyDataTableRowName::Editor::FRowNameOptionsBatchMenu::Unregister()
+{
+	if(UObjectInitialized())
+	{
+		UToolMenus::UnRegisterStartupCallback(StartupCallbackHandle);
+		UToolMenus::UnregisterOwner(BatchMenuOwnerName);
+	}
+	StartupCallbackHandle.Reset();
+}
+
+void EasyDataTableRowName::Editor::FRowNameOptionsBatchMenu::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(BatchMenuOwnerName);
+	UToolMenu* Menu = UToolMenus::Get()->ExtendMenu("ContentBrowser.AssetContextMenu.Blueprint");
+	FToolMenuSection& Section = Menu->FindOrAddSection("GetAssetActions");
+	Section.AddDynamicEntry("EasyDataTableRowNameBatch", FNewToolMenuSectionDelegate::CreateLambda([](FToolMenuSection& InSection)
+	{
+		const UContentBrowserAssetContextMenuContext* Context = InSection.FindContext<UContentBrowserAssetContextMenuContext>();
+		if(Context == nullptr || Context->SelectedAssets.IsEmpty())
+		{
+			return;
+		}
+		InSection.AddMenuEntry(
+			"AssignRowNameOptionsSource",
+			LOCTEXT("AssignRowNameOptionsSource", "Assign Row Name Options Source"),
+			LOCTEXT("AssignRowNameOptionsSourceTooltip", "Set the DataTable / CurveTable / StringTable of FName variables in all selected Blueprints"),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateStatic(&FRowNameOptionsBatchMenu::OpenDialog, Context->SelectedAssets)));
+	}));
+}
+
+void EasyDataTableRowName::Editor::FRowNameOptionsBatchMenu::OpenDialog(TArray<FAssetData> BlueprintAssets)
+{
+	TSharedRef<SWindow> Window = SNew(SWindow)
+		.Title(LOCTEXT("AssignRowNameOptionsSource", "Assign Row Name Options Source"))
+		.SizingRule(ESizingRule::Autosized)
+		.SupportsMinimize(false)
+		.SupportsMaximize(false);
+
+	Window->SetContent(
+		SNew(SRowNameOptionsBatchDialog)
+		.BlueprintAssets(BlueprintAssets)
+		.ParentWindow(Window));
+
+	IMainFrameModule& MainFrameModule = FModuleManager::LoadModuleChecked<IMainFrameModule>("MainFrame");
+	FSlateApplication::Get().AddWindowAsNativeChild(Window, MainFrameModule.GetParentWindow().ToSharedRef());
+}
+
+void EasyDataTableRowName::Editor::SRowNameOptionsBatchDialog::Construct(const FArguments& InArgs)
+{
+	BlueprintAssets = InArgs._BlueprintAssets;
+	ParentWindow = InArgs._ParentWindow;
+
+	auto MakeCheckBox = [](bool* bValue, const FText& Label)
+	{
+		return SNew(SCheckBox)
+			.IsChecked_Lambda([bValue]() { return *bValue ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+			.OnCheckStateChanged_Lambda([bValue](ECheckBoxState State) { *bValue = State == ECheckBoxState::Checked; })
+			[
+				SNew(STextBlock)
+				.Text(Label)
+			];
+	};
+
+	ChildSlot
+	[
+		SNew(SBox)
+		.MinDesiredWidth(400)
+		.Padding(8.0f)
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(2.0f)
+			[
+				SNew(STextBlock)
+				.Text(FText::Format(LOCTEXT("BatchBlueprintCount", "{0} Blueprint(s) selected"), BlueprintAssets.Num()))
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(2.0f)
+			[
+				SNew(SDataTablePathSelector)
+				.OnPathChanged(FOnPathChanged::CreateSP(this, &SRowNameOptionsBatchDialog::OnSourcePathChanged))
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(2.0f)
+			[
+				MakeCheckBox(&bAssignCommon, LOCTEXT("BatchCommonSlot", "FName / Array / Set variables"))
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(2.0f)
+			[
+				MakeCheckBox(&bAssignKey, LOCTEXT("BatchKeySlot", "Map keys"))
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(2.0f)
+			[
+				MakeCheckBox(&bAssignValue, LOCTEXT("BatchValueSlot", "Map values"))
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(2.0f)
+			[
+				MakeCheckBox(&bCompile, LOCTEXT("BatchCompile", "Compile changed Blueprints"))
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Right)
+			.Padding(2.0f, 8.0f, 2.0f, 2.0f)
+			[
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(2.0f, 0.0f)
+				[
+					SNew(SButton)
+					.Text(LOCTEXT("BatchApply", "Apply"))
+					.ToolTipText(LOCTEXT("BatchApplyTooltip", "Pick a source first"))
+					.IsEnabled(this, &SRowNameOptionsBatchDialog::CanApply)
+					.OnClicked(this, &SRowNameOptionsBatchDialog::OnApply)
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(2.0f, 0.0f)
+				[
+					SNew(SButton)
+					.Text(LOCTEXT("BatchClear", "Clear"))
+					.ToolTipText(LOCTEXT("BatchClearTooltip", "Remove the source of the checked slots from every variable"))
+					.OnClicked(this, &SRowNameOptionsBatchDialog::OnClear)
+				]
+				+ SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(2.0f, 0.0f)
+				[
+					SNew(SButton)
+					.Text(LOCTEXT("BatchCancel", "Cancel"))
+					.OnClicked(this, &SRowNameOptionsBatchDialog::OnCancel)
+				]
+			]
+		]
+	];
+}
+
+void EasyDataTableRowName::Editor::SRowNameOptionsBatchDialog::OnSourcePathChanged(const FSoftObjectPath& Path)
+{
+	SourcePath = Path;
+}
+
+bool EasyDataTableRowName::Editor::SRowNameOptionsBatchDialog::CanApply() const
+{
+	// A null path clears every matching variable, that only happens through OnClear
+	return !SourcePath.IsNull();
+}
+
+FReply EasyDataTableRowName::Editor::SRowNameOptionsBatchDialog::OnApply()
+{
+	if(!CanApply())
+	{
+		return FReply::Handled();
+	}
+	AssignCheckedSlots(SourcePath, LOCTEXT("AssignRowNameOptionsSource", "Assign Row Name Options Source"));
+	return OnCancel();
+}
+
+FReply EasyDataTableRowName::Editor::SRowNameOptionsBatchDialog::OnClear()
+{
+	const FText Message = FText::Format(LOCTEXT("BatchClearConfirm",
+		"Remove the row name options source of the checked slots from every variable of {0} Blueprint(s)?"), BlueprintAssets.Num());
+	if(FMessageDialog::Open(EAppMsgType::YesNo, EAppReturnType::No, Message) != EAppReturnType::Yes)
+	{
+		return FReply::Handled();
+	}
+	AssignCheckedSlots(FSoftObjectPath(), LOCTEXT("ClearRowNameOptionsSource", "Clear Row Name Options Source"));
+	return OnCancel();
+}
+
+void EasyDataTableRowName::Editor::SRowNameOptionsBatchDialog::AssignCheckedSlots(const FSoftObjectPath& Path,
+	const FText& TransactionText)
+{
+	FRowNameOptionsBatch Batch;
+	for (const FAssetData& AssetData : BlueprintAssets)
+	{
+		UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+		if(bAssignCommon)
+		{
+			Batch.Assign(Blueprint, NAME_None, ERowNameOptionsSlot::Common, Path);
+		}
+		if(bAssignKey)
+		{
+			Batch.Assign(Blueprint, NAME_None, ERowNameOptionsSlot::Key, Path);
+		}
+		if(bAssignValue)
+		{
+			Batch.Assign(Blueprint, NAME_None, ERowNameOptionsSlot::Value, Path);
+		}
+	}
+	const int32 NumRejected = Batch.GetNumRejected();
+	const int32 NumChanged = Batch.Apply(TransactionText, bCompile);
+
+	FNotificationInfo Info(NumRejected > 0
+		? FText::Format(LOCTEXT("BatchRejected", "{0} is not a row name source, nothing was changed"), FText::FromString(Path.ToString()))
+		: FText::Format(LOCTEXT("BatchResult", "Updated {0} variable(s)"), NumChanged));
+	Info.ExpireDuration = 3.0f;
+	TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(Info);
+	if(Notification.IsValid() && NumRejected > 0)
+	{
+		Notification->SetCompletionState(SNotificationItem::CS_Fail);
+	}
+}
+
+FReply EasyDataTableRowName::Editor::SRowNameOptionsBatchDialog::OnCancel()
+{
+	if(TSharedPtr<SWindow> Window = ParentWindow.Pin())
+	{
+		Window->RequestDestroyWindow();
+	}
+	return FReply::Handled();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,53 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Widgets/SCompoundWidget.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	/** "Assign Row Name Options Source" entry of the Blueprint asset context menu */
+	class FRowNameOptionsBatchMenu
+	{
+		public:
+			static void Register();
+			static void Unregister();
+
+		private:
+			static void RegisterMenus();
+			static void OpenDialog(TArray<FAssetData> BlueprintAssets);
+
+			static FDelegateHandle StartupCallbackHandle;
+	};
+
+	/** Picks a source and the slots to assign on every FName-related variable of the selected Blueprints */
+	class SRowNameOptionsBatchDialog : public SCompoundWidget
+	{
+		SLATE_BEGIN_ARGS(SRowNameOptionsBatchDialog)
+			{}
+			SLATE_ARGUMENT(TArray<FAssetData>, BlueprintAssets)
+			SLATE_ARGUMENT(TWeakPtr<SWindow>, ParentWindow)
+
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& InArgs);
+
+		protected:
+			void OnSourcePathChanged(const FSoftObjectPath& Path);
+			bool CanApply() const;
+			FReply OnApply();
+			/** Removes the source of the checked slots, after a confirmation */
+			FReply OnClear();
+			FReply OnCancel();
+			void AssignCheckedSlots(const FSoftObjectPath& Path, const FText& TransactionText);
+
+		protected:
+			TArray<FAssetData> BlueprintAssets;
+			TWeakPtr<SWindow> ParentWindow;
+			FSoftObjectPath SourcePath;
+			bool bAssignCommon = true;
+			bool bAssignKey = false;
+			bool bAssignValue = false;
+			bool bCompile = true;
+	};
+}
@@ -0,0 +1,321 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameSourceRenameHandler.h"
+
+#include "RowNameOptionsBatch.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "FileHelpers.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopedSlowTask.h"
+#include "RowNameSource/RowNameSourceRedirects.h"
+#include "UObject/UObjectIterator.h"
+
+#define LOCTEXT_NAMESPACE "EasyDataTableRowName"
+
+const FName EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::SourcesTagName(TEXT("EasyRowNameSources"));
+FDelegateHandle EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::ExtraObjectTagsHandle;
+FDelegateHandle EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::AssetRenamedHandle;
+FTSTicker::FDelegateHandle EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::TickHandle;
+TArray<TPair<FSoftObjectPath, FSoftObjectPath>> EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::PendingRenames;
+IConsoleObject* EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::TagBlueprintSourcesCommand = nullptr;
+
+void EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::Register()
+{
+	ExtraObjectTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTags.AddStatic(&FRowNameSourceRenameHandler::OnGetExtraObjectTags);
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&FRowNameSourceRenameHandler::OnAssetRenamed);
+	TagBlueprintSourcesCommand = IConsoleManager::Get().RegisterConsoleCommand(TEXT("EasyDataTableRowName.TagBlueprintSources"),
+		TEXT("Resaves Blueprints saved without the row name source tag, so renamed tables find them without a file search"),
+		FConsoleCommandDelegate::CreateStatic(&FRowNameSourceRenameHandler::TagBlueprintSources));
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::Unregister()
+{
+	UObject::FAssetRegistryTag::OnGetExtraObjectTags.Remove(ExtraObjectTagsHandle);
+	ExtraObjectTagsHandle.Reset();
+	if(FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+	{
+		AssetRegistryModule->Get().OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+	AssetRenamedHandle.Reset();
+	if(TagBlueprintSourcesCommand != nullptr)
+	{
+		IConsoleManager::Get().UnregisterConsoleObject(TagBlueprintSourcesCommand);
+		TagBlueprintSourcesCommand = nullptr;
+	}
+	if(TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+	PendingRenames.Reset();
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::OnGetExtraObjectTags(const UObject* Object,
+	TArray<UObject::FAssetRegistryTag>& OutTags)
+{
+	const UBlueprint* Blueprint = Cast<UBlueprint>(Object);
+	if(Blueprint == nullptr)
+	{
+		return;
+	}
+
+	// Written for every Blueprint, empty values are dropped by the registry and ";" parses to no path,
+	// so a missing tag reliably means the Blueprint was saved before it existed
+	TArray<FString> Paths;
+	GetBlueprintSourcePaths(Blueprint, Paths);
+	const FString TagValue = Paths.IsEmpty() ? FString(TEXT(";")) : FString::Join(Paths, TEXT(";"));
+	OutTags.Add(UObject::FAssetRegistryTag(SourcesTagName, TagValue, UObject::FAssetRegistryTag::TT_Hidden));
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::OnAssetRenamed(const FAssetData& AssetData,
+	const FString& OldObjectPath)
+{
+	if(!FRowNameSourceProviderRegistry::Get().FindProviderForClass(AssetData.GetClass()).IsValid())
+	{
+		return;
+	}
+
+	const FSoftObjectPath OldPath(OldObjectPath);
+	const FSoftObjectPath NewPath = AssetData.GetSoftObjectPath();
+	// Pickers follow the move right away, the Blueprints are rewritten once the rename is done
+	FRowNameSourceRedirects::Get().AddRedirect(OldPath, NewPath);
+	PendingRenames.Emplace(OldPath, NewPath);
+	if(!TickHandle.IsValid())
+	{
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FRowNameSourceRenameHandler::ProcessPendingRenames));
+	}
+}
+
+bool EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::ProcessPendingRenames(float DeltaTime)
+{
+	TickHandle.Reset();
+	const TArray<TPair<FSoftObjectPath, FSoftObjectPath>> Renames = MoveTemp(PendingRenames);
+	PendingRenames.Reset();
+
+	TArray<TPair<FSoftObjectPath, FSoftObjectPath>> ValidRenames;
+	TArray<FString> OldPathStrings;
+	for (const TPair<FSoftObjectPath, FSoftObjectPath>& Rename : Renames)
+	{
+		// Retargeting to a path no provider resolves would clear the metadata instead of moving it
+		if(!FRowNameSourceProviderRegistry::Get().FindProviderForPath(Rename.Value).IsValid())
+		{
+			UE_LOG(LogEasyDataTableRowName, Warning, TEXT("Renamed source %s cannot be resolved, Blueprint variables still point at %s"),
+				*Rename.Value.ToString(), *Rename.Key.ToString());
+			continue;
+		}
+		ValidRenames.Add(Rename);
+		OldPathStrings.Add(Rename.Key.ToString());
+	}
+
+	// Moving a folder renames many sources at once, untagged packages are read for all of them together
+	TArray<TSet<UBlueprint*>> Blueprints;
+	Blueprints.SetNum(ValidRenames.Num());
+	FindUntaggedReferencingBlueprints(OldPathStrings, Blueprints);
+
+	FRowNameOptionsBatch Batch;
+	for (int32 Index = 0; Index < ValidRenames.Num(); ++Index)
+	{
+		const TPair<FSoftObjectPath, FSoftObjectPath>& Rename = ValidRenames[Index];
+		FindReferencingBlueprints(Rename.Key, Blueprints[Index]);
+		for (UBlueprint* Blueprint : Blueprints[Index])
+		{
+			Batch.Retarget(Blueprint, Rename.Key, Rename.Value);
+		}
+	}
+
+	if(!Batch.IsEmpty())
+	{
+		// Metadata of the generated classes is updated in place, no compile needed
+		const int32 NumChanged = Batch.Apply(LOCTEXT("RetargetRenamedSources", "Retarget Renamed Row Name Sources"), false);
+		UE_LOG(LogEasyDataTableRowName, Display, TEXT("Retargeted %d Blueprint variables to renamed row name sources"), NumChanged);
+	}
+	return false;
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::FindReferencingBlueprints(
+	const FSoftObjectPath& SourcePath, TSet<UBlueprint*>& OutBlueprints)
+{
+	const FString PathString = SourcePath.ToString();
+	TArray<FString> Paths;
+
+	// Loaded Blueprints may have unsaved changes the tag does not know about yet
+	for (TObjectIterator<UBlueprint> It; It; ++It)
+	{
+		Paths.Reset();
+		GetBlueprintSourcePaths(*It, Paths);
+		if(Paths.Contains(PathString))
+		{
+			OutBlueprints.Add(*It);
+		}
+	}
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.TagsAndValues.Add(SourcesTagName, TOptional<FString>());
+	TArray<FAssetData> Assets;
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().GetAssets(Filter, Assets);
+	for (const FAssetData& Asset : Assets)
+	{
+		FString TagValue;
+		if(Asset.IsAssetLoaded() || !Asset.GetTagValue(SourcesTagName, TagValue))
+		{
+			continue;
+		}
+		Paths.Reset();
+		TagValue.ParseIntoArray(Paths, TEXT(";"));
+		if(!Paths.Contains(PathString))
+		{
+			continue;
+		}
+		if(UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
+		{
+			OutBlueprints.Add(Blueprint);
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::FindUntaggedReferencingBlueprints(
+	const TArray<FString>& PathStrings, TArray<TSet<UBlueprint*>>& OutBlueprints)
+{
+	if(PathStrings.IsEmpty())
+	{
+		return;
+	}
+
+	// Untagged Blueprints are searched on disk, only the packages mentioning an old path get loaded
+	TArray<FAssetData> UntaggedAssets;
+	GetUntaggedBlueprints(UntaggedAssets);
+	if(!UntaggedAssets.IsEmpty())
+	{
+		UE_LOG(LogEasyDataTableRowName, Display, TEXT("Searching %d Blueprints saved without the row name source tag for %d renamed sources, run EasyDataTableRowName.TagBlueprintSources once to avoid it"),
+			UntaggedAssets.Num(), PathStrings.Num());
+	}
+	TArray<int32> Mentions;
+	for (const FAssetData& Asset : UntaggedAssets)
+	{
+		FindMentions(Asset.PackageName, PathStrings, Mentions);
+		if(Mentions.IsEmpty())
+		{
+			continue;
+		}
+		if(UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
+		{
+			for (const int32 Index : Mentions)
+			{
+				OutBlueprints[Index].Add(Blueprint);
+			}
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::GetUntaggedBlueprints(TArray<FAssetData>& OutAssets)
+{
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.PackagePaths.Add(TEXT("/Game"));
+	Filter.bRecursivePaths = true;
+	TArray<FAssetData> Assets;
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().GetAssets(Filter, Assets);
+	for (FAssetData& Asset : Assets)
+	{
+		if(!Asset.IsAssetLoaded() && !Asset.FindTag(SourcesTagName))
+		{
+			OutAssets.Add(MoveTemp(Asset));
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::FindMentions(const FName& PackageName,
+	const TArray<FString>& Texts, TArray<int32>& OutIndices)
+{
+	OutIndices.Reset();
+	FString Filename;
+	TArray<uint8> Bytes;
+	if(!FPackageName::DoesPackageExist(PackageName.ToString(), &Filename) || !FFileHelper::LoadFileToArray(Bytes, *Filename, FILEREAD_Silent))
+	{
+		return;
+	}
+
+	// FString serializes as ANSI when every character fits, as UTF-16 otherwise
+	auto Contains = [&Bytes](const uint8* Needle, int32 NeedleSize)
+	{
+		for (int32 Index = 0; Index + NeedleSize <= Bytes.Num(); ++Index)
+		{
+			if(Bytes[Index] == Needle[0] && FMemory::Memcmp(Bytes.GetData() + Index, Needle, NeedleSize) == 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+	for (int32 Index = 0; Index < Texts.Num(); ++Index)
+	{
+		const FTCHARToUTF8 Ansi(*Texts[Index]);
+		const FTCHARToUTF16 Utf16(*Texts[Index]);
+		if(Contains(reinterpret_cast<const uint8*>(Ansi.Get()), Ansi.Length())
+			|| Contains(reinterpret_cast<const uint8*>(Utf16.Get()), Utf16.Length() * sizeof(UTF16CHAR)))
+		{
+			OutIndices.Add(Index);
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::TagBlueprintSources()
+{
+	TArray<FAssetData> UntaggedAssets;
+	GetUntaggedBlueprints(UntaggedAssets);
+	if(UntaggedAssets.IsEmpty())
+	{
+		UE_LOG(LogEasyDataTableRowName, Display, TEXT("Every Blueprint already carries the row name source tag"));
+		return;
+	}
+
+	FScopedSlowTask SlowTask(UntaggedAssets.Num(), LOCTEXT("TagBlueprintSources", "Tagging Blueprint row name sources"));
+	SlowTask.MakeDialog(true);
+	TArray<UPackage*> Packages;
+	for (const FAssetData& Asset : UntaggedAssets)
+	{
+		if(SlowTask.ShouldCancel())
+		{
+			break;
+		}
+		SlowTask.EnterProgressFrame(1.0f);
+		if(UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
+		{
+			Packages.Add(Blueprint->GetPackage());
+		}
+	}
+	// Saving writes the tag, source control checkout is offered as for any save
+	FEditorFileUtils::PromptForCheckoutAndSave(Packages, false, false);
+	UE_LOG(LogEasyDataTableRowName, Display, TEXT("Resaved %d Blueprints with the row name source tag"), Packages.Num());
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::GetBlueprintSourcePaths(const UBlueprint* Blueprint,
+	TArray<FString>& OutPaths)
+{
+	const TArray<TSharedRef<FRowNameSourceProvider>>& Providers = FRowNameSourceProviderRegistry::Get().GetProviders();
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		for (const ERowNameOptionsSlot Slot : {ERowNameOptionsSlot::Common, ERowNameOptionsSlot::Key, ERowNameOptionsSlot::Value})
+		{
+			for (const TSharedRef<FRowNameSourceProvider>& Provider : Providers)
+			{
+				const FName& MetaDataKey = Provider->GetMetaDataKey(Slot);
+				if(Variable.HasMetaData(MetaDataKey))
+				{
+					OutPaths.AddUnique(Variable.GetMetaData(MetaDataKey));
+				}
+			}
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,52 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
+
+class UBlueprint;
+
+namespace EasyDataTableRowName::Editor
+{
+	/**
+	 * Keeps row name metadata pointing at renamed or moved source assets.
+	 * Blueprints list the sources of their variables in an asset registry tag, so a rename only loads
+	 * and rewrites the Blueprints referencing the old path, all renames of a frame in one batch.
+	 * The old path is also recorded in FRowNameSourceRedirects for C++ metadata.
+	 * Blueprints saved before the tag existed have none; on rename their package files are read once per
+	 * batch and searched for every old path, only the matches are loaded.
+	 * EasyDataTableRowName.TagBlueprintSources resaves them once.
+	 */
+	class FRowNameSourceRenameHandler
+	{
+		public:
+			/** Asset registry tag of Blueprints, the source paths of their variables separated by ';', ";" when there are none */
+			static const FName SourcesTagName;
+
+			static void Register();
+			static void Unregister();
+
+		private:
+			static void OnGetExtraObjectTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags);
+			static void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+			static bool ProcessPendingRenames(float DeltaTime);
+			/** Loaded and tagged Blueprints referencing SourcePath */
+			static void FindReferencingBlueprints(const FSoftObjectPath& SourcePath, TSet<UBlueprint*>& OutBlueprints);
+			/** Untagged Blueprints referencing each of PathStrings, every package file is read once for all of them */
+			static void FindUntaggedReferencingBlueprints(const TArray<FString>& PathStrings, TArray<TSet<UBlueprint*>>& OutBlueprints);
+			/** Unloaded Blueprints saved without SourcesTagName */
+			static void GetUntaggedBlueprints(TArray<FAssetData>& OutAssets);
+			/** Indices of Texts the package file holds as serialized ANSI or UTF-16 strings */
+			static void FindMentions(const FName& PackageName, const TArray<FString>& Texts, TArray<int32>& OutIndices);
+			/** Console command, loads and resaves untagged Blueprints so later renames find them through the tag */
+			static void TagBlueprintSources();
+			static void GetBlueprintSourcePaths(const UBlueprint* Blueprint, TArray<FString>& OutPaths);
+
+			static FDelegateHandle ExtraObjectTagsHandle;
+			static FDelegateHandle AssetRenamedHandle;
+			static FTSTicker::FDelegateHandle TickHandle;
+			static IConsoleObject* TagBlueprintSourcesCommand;
+			/** Old and new path of sources renamed since the last tick */
+			static TArray<TPair<FSoftObjectPath, FSoftObjectPath>> PendingRenames;
+	};
+}
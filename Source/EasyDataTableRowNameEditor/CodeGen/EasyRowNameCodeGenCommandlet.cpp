@@ -0,0 +1,73 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EasyRowNameCodeGenCommandlet.h"
+
+#include "RowNameHeaderGenerator.h"
+#include "Engine/DataTable.h"
+#include "RowNameSource/RowNameSourceProvider.h"
+#include "Settings/EasyDataTableRowNameSettings.h"
+
+UEasyRowNameCodeGenCommandlet::UEasyRowNameCodeGenCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UEasyRowNameCodeGenCommandlet::Main(const FString& Params)
+{
+	using namespace EasyDataTableRowName::Editor;
+
+	TArray<FSoftObjectPath> TablePaths;
+	FString TablesParam;
+	if(FParse::Value(*Params, TEXT("Tables="), TablesParam, false))
+	{
+		TArray<FString> Paths;
+		TablesParam.ParseIntoArray(Paths, TEXT("+"));
+		for (const FString& Path : Paths)
+		{
+			TablePaths.Add(FSoftObjectPath(Path));
+		}
+	}
+	else
+	{
+		for (const TSoftObjectPtr<UDataTable>& Table : GetDefault<UEasyDataTableRowNameSettings>()->RowNameHeaderTables)
+		{
+			TablePaths.Add(Table.ToSoftObjectPath());
+		}
+	}
+
+	FString OutputDirectory;
+	if(!FParse::Value(*Params, TEXT("Output="), OutputDirectory))
+	{
+		OutputDirectory = FRowNameHeaderGenerator::GetDefaultOutputDirectory();
+	}
+	const bool bForce = FParse::Param(*Params, TEXT("Force"));
+
+	int32 NumWritten = 0;
+	int32 NumFailed = 0;
+	for (const FSoftObjectPath& TablePath : TablePaths)
+	{
+		const UDataTable* Table = Cast<UDataTable>(TablePath.TryLoad());
+		FString Error;
+		switch (FRowNameHeaderGenerator::Generate(Table, OutputDirectory, bForce, Error))
+		{
+		case ERowNameHeaderResult::Written:
+			++NumWritten;
+			UE_LOG(LogEasyDataTableRowName, Display, TEXT("Generated %s"), *FRowNameHeaderGenerator::GetHeaderPath(Table, OutputDirectory));
+			break;
+		case ERowNameHeaderResult::UpToDate:
+			break;
+		case ERowNameHeaderResult::Failed:
+			++NumFailed;
+			UE_LOG(LogEasyDataTableRowName, Error, TEXT("%s: %s"), *TablePath.ToString(), *Error);
+			break;
+		}
+	}
+
+	UE_LOG(LogEasyDataTableRowName, Display, TEXT("Row name headers: %d written, %d up to date, %d failed"),
+		NumWritten, TablePaths.Num() - NumWritten - NumFailed, NumFailed);
+	return NumFailed > 0 ? 1 : 0;
+}
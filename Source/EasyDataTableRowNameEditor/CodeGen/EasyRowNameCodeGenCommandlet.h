@@ -0,0 +1,21 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EasyRowNameCodeGenCommandlet.generated.h"
+
+/**
+ * Generates row name headers without opening the editor, for build scripts.
+ * -run=EasyRowNameCodeGen [-Tables=/Game/A.A+/Game/B.B] [-Output=Dir] [-Force]
+ * Without -Tables, the tables listed in the plugin settings are generated. Unchanged row sets are skipped.
+ */
+UCLASS()
+class UEasyRowNameCodeGenCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEasyRowNameCodeGenCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
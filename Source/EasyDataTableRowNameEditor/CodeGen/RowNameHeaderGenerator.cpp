@@ -0,0 +1,238 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameHeaderGenerator.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/DataTable.h"
+#include "Hash/CityHash.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RowNameSource/RowNameSourceProvider.h"
+#include "Settings/EasyDataTableRowNameSettings.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	/** Bump when the generated layout changes, every header is rewritten on the next run */
+	static constexpr int32 RowNameHeaderFormatVersion = 1;
+	static const TCHAR* RowSetHashPrefix = TEXT("// RowSetHash: ");
+	static const TCHAR* GeneratedFromPrefix = TEXT("// Generated by EasyDataTableRowName from ");
+	static const TCHAR* GeneratedFromSuffix = TEXT(", do not edit.");
+}
+
+FString EasyDataTableRowName::Editor::FRowNameHeaderGenerator::GetDefaultOutputDirectory()
+{
+	const FString& Directory = GetDefault<UEasyDataTableRowNameSettings>()->RowNameHeaderDirectory.Path;
+	if(Directory.IsEmpty())
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::GameSourceDir() / FApp::GetProjectName() / TEXT("EasyRowNames"));
+	}
+	return FPaths::ConvertRelativePathToFull(FPaths::IsRelative(Directory) ? FPaths::ProjectDir() / Directory : Directory);
+}
+
+FString EasyDataTableRowName::Editor::FRowNameHeaderGenerator::GetHeaderPath(const UDataTable* Table,
+	const FString& OutputDirectory)
+{
+	return OutputDirectory / Table->GetName() + TEXT("RowNames.h");
+}
+
+EasyDataTableRowName::Editor::ERowNameHeaderResult EasyDataTableRowName::Editor::FRowNameHeaderGenerator::Generate(
+	const UDataTable* Table, const FString& OutputDirectory, bool bForce, FString& OutError)
+{
+	if(Table == nullptr)
+	{
+		OutError = TEXT("no table");
+		return ERowNameHeaderResult::Failed;
+	}
+
+	const TArray<FName> RowNames = Table->GetRowNames();
+	const FString RowSetHash = ComputeRowSetHash(Table->GetPathName(), RowNames);
+	const FString HeaderPath = GetHeaderPath(Table, OutputDirectory);
+	FString HeaderTablePath;
+	FString HeaderRowSetHash;
+	ReadHeaderStamp(HeaderPath, HeaderTablePath, HeaderRowSetHash);
+
+	// Same file name and namespace, the two tables would overwrite each other on every run
+	if(!HeaderTablePath.IsEmpty() && HeaderTablePath != Table->GetPathName())
+	{
+		const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		if(AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(HeaderTablePath)).IsValid())
+		{
+			OutError = FString::Printf(TEXT("%s is generated from %s, which has the same name; rename one of the tables"),
+				*HeaderPath, *HeaderTablePath);
+			return ERowNameHeaderResult::Failed;
+		}
+	}
+	if(!bForce && HeaderRowSetHash == RowSetHash)
+	{
+		return ERowNameHeaderResult::UpToDate;
+	}
+
+	IFileManager::Get().MakeDirectory(*OutputDirectory, true);
+	if(!FFileHelper::SaveStringToFile(MakeHeader(Table, RowNames, RowSetHash), *HeaderPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		OutError = FString::Printf(TEXT("cannot write %s, is it read-only?"), *HeaderPath);
+		return ERowNameHeaderResult::Failed;
+	}
+	return ERowNameHeaderResult::Written;
+}
+
+FString EasyDataTableRowName::Editor::FRowNameHeaderGenerator::MakeHeader(const UDataTable* Table,
+	const TArray<FName>& RowNames, const FString& RowSetHash)
+{
+	FIdentifierSet UsedIdentifiers;
+	bool bSuffixed = false;
+	const FString NamespaceName = MakeIdentifier(Table->GetName(), UsedIdentifiers, bSuffixed);
+	UsedIdentifiers.Reset();
+	TArray<FString> Identifiers;
+	TArray<FString> Strings;
+	for (const FName& RowName : RowNames)
+	{
+		const FString RowString = RowName.ToString();
+		Identifiers.Add(MakeIdentifier(RowString, UsedIdentifiers, bSuffixed));
+		Strings.Add(EscapeString(RowString));
+		// Suffixes follow table order, reordering rows silently moves them to other rows
+		UE_CLOG(bSuffixed, LogEasyDataTableRowName, Warning,
+			TEXT("Row \"%s\" of %s maps to an identifier already taken, generated %s, which changes when rows are reordered"),
+			*RowString, *Table->GetPathName(), *Identifiers.Last());
+	}
+
+	TStringBuilder<4096> Header;
+	Header.Appendf(TEXT("%s%s%s\n"), GeneratedFromPrefix, *Table->GetPathName(), GeneratedFromSuffix);
+	Header.Append(TEXT("// Regenerate with \"Generate Row Name Header\" on the table or the EasyRowNameCodeGen commandlet.\n"));
+	Header.Appendf(TEXT("%s%s\n\n"), RowSetHashPrefix, *RowSetHash);
+	Header.Append(TEXT("#pragma once\n\n#include \"CoreMinimal.h\"\n\n"));
+	Header.Appendf(TEXT("namespace EasyRowNames::%s\n{\n"), *NamespaceName);
+	Header.Appendf(TEXT("\tinline constexpr int32 RowCount = %d;\n\n"), RowNames.Num());
+
+	Header.Append(TEXT("\t/** Dense row indices, in table order */\n\tenum class ERow : int32\n\t{\n"));
+	for (int32 Index = 0; Index < Identifiers.Num(); ++Index)
+	{
+		Header.Appendf(TEXT("\t\t%s = %d,\n"), *Identifiers[Index], Index);
+	}
+	Header.Append(TEXT("\t};\n"));
+
+	// Zero sized arrays are not valid C++, an empty table only gets its count and enum
+	if(!RowNames.IsEmpty())
+	{
+		Header.Append(TEXT("\n\tinline constexpr const TCHAR* RowStrings[RowCount] =\n\t{\n"));
+		for (const FString& String : Strings)
+		{
+			Header.Appendf(TEXT("\t\tTEXT(\"%s\"),\n"), *String);
+		}
+		Header.Append(TEXT("\t};\n"));
+
+		Header.Append(TEXT("\n\t/** Created once at static initialization, indexed by ERow */\n\tinline const FName RowNames[RowCount] =\n\t{\n"));
+		for (const FString& String : Strings)
+		{
+			Header.Appendf(TEXT("\t\tFName(TEXT(\"%s\")),\n"), *String);
+		}
+		Header.Append(TEXT("\t};\n\n"));
+		Header.Append(TEXT("\tinline const FName& GetRowName(ERow Row) { return RowNames[static_cast<int32>(Row)]; }\n\n"));
+
+		Header.Append(TEXT("\tnamespace Names\n\t{\n"));
+		for (int32 Index = 0; Index < Identifiers.Num(); ++Index)
+		{
+			Header.Appendf(TEXT("\t\tinline const FName& %s = RowNames[%d];\n"), *Identifiers[Index], Index);
+		}
+		Header.Append(TEXT("\t}\n"));
+	}
+	Header.Append(TEXT("}\n"));
+	return FString(Header.ToView());
+}
+
+FString EasyDataTableRowName::Editor::FRowNameHeaderGenerator::ComputeRowSetHash(const FString& TablePath,
+	const TArray<FName>& RowNames)
+{
+	// Order is part of the hash, indices follow it
+	FString Joined = FString::Printf(TEXT("%d\n%s"), RowNameHeaderFormatVersion, *TablePath);
+	for (const FName& RowName : RowNames)
+	{
+		Joined.AppendChar(TEXT('\n'));
+		Joined.Append(RowName.ToString());
+	}
+	const FTCHARToUTF8 Utf8(*Joined);
+	return FString::Printf(TEXT("%016llx"), CityHash64(Utf8.Get(), Utf8.Length()));
+}
+
+void EasyDataTableRowName::Editor::FRowNameHeaderGenerator::ReadHeaderStamp(const FString& HeaderPath,
+	FString& OutTablePath, FString& OutRowSetHash)
+{
+	OutTablePath.Reset();
+	OutRowSetHash.Reset();
+	TArray<FString> Lines;
+	if(!FFileHelper::LoadFileToStringArray(Lines, *HeaderPath))
+	{
+		return;
+	}
+	for (int32 Index = 0; Index < Lines.Num() && Index < 4; ++Index)
+	{
+		const FString Line = Lines[Index].TrimEnd();
+		if(Line.StartsWith(RowSetHashPrefix, ESearchCase::CaseSensitive))
+		{
+			OutRowSetHash = Line.RightChop(FCString::Strlen(RowSetHashPrefix));
+		}
+		else if(Line.StartsWith(GeneratedFromPrefix, ESearchCase::CaseSensitive) && Line.EndsWith(GeneratedFromSuffix, ESearchCase::CaseSensitive))
+		{
+			OutTablePath = Line.Mid(FCString::Strlen(GeneratedFromPrefix),
+				Line.Len() - FCString::Strlen(GeneratedFromPrefix) - FCString::Strlen(GeneratedFromSuffix));
+		}
+	}
+}
+
+FString EasyDataTableRowName::Editor::FRowNameHeaderGenerator::MakeIdentifier(const FString& Name,
+	FIdentifierSet& UsedIdentifiers, bool& bOutSuffixed)
+{
+	// C++20 keywords and alternative tokens, plus the names the generated namespace declares itself
+	static const FIdentifierSet Keywords =
+	{
+		TEXT("alignas"), TEXT("alignof"), TEXT("and"), TEXT("and_eq"), TEXT("asm"), TEXT("auto"), TEXT("bitand"),
+		TEXT("bitor"), TEXT("bool"), TEXT("break"), TEXT("case"), TEXT("catch"), TEXT("char"), TEXT("char8_t"),
+		TEXT("char16_t"), TEXT("char32_t"), TEXT("class"), TEXT("compl"), TEXT("concept"), TEXT("const"),
+		TEXT("consteval"), TEXT("constexpr"), TEXT("constinit"), TEXT("const_cast"), TEXT("continue"),
+		TEXT("co_await"), TEXT("co_return"), TEXT("co_yield"), TEXT("decltype"), TEXT("default"), TEXT("delete"),
+		TEXT("do"), TEXT("double"), TEXT("dynamic_cast"), TEXT("else"), TEXT("enum"), TEXT("explicit"),
+		TEXT("export"), TEXT("extern"), TEXT("false"), TEXT("float"), TEXT("for"), TEXT("friend"), TEXT("goto"),
+		TEXT("if"), TEXT("inline"), TEXT("int"), TEXT("long"), TEXT("mutable"), TEXT("namespace"), TEXT("new"),
+		TEXT("noexcept"), TEXT("not"), TEXT("not_eq"), TEXT("nullptr"), TEXT("operator"), TEXT("or"),
+		TEXT("or_eq"), TEXT("private"), TEXT("protected"), TEXT("public"), TEXT("register"),
+		TEXT("reinterpret_cast"), TEXT("requires"), TEXT("return"), TEXT("short"), TEXT("signed"), TEXT("sizeof"),
+		TEXT("static"), TEXT("static_assert"), TEXT("static_cast"), TEXT("struct"), TEXT("switch"),
+		TEXT("template"), TEXT("this"), TEXT("thread_local"), TEXT("throw"), TEXT("true"), TEXT("try"),
+		TEXT("typedef"), TEXT("typeid"), TEXT("typename"), TEXT("union"), TEXT("unsigned"), TEXT("using"),
+		TEXT("virtual"), TEXT("void"), TEXT("volatile"), TEXT("wchar_t"), TEXT("while"), TEXT("xor"),
+		TEXT("xor_eq"), TEXT("RowCount"), TEXT("RowStrings"), TEXT("RowNames"), TEXT("GetRowName"),
+	};
+
+	FString Identifier;
+	Identifier.Reserve(Name.Len() + 4);
+	for (const TCHAR Char : Name)
+	{
+		Identifier.AppendChar(FChar::IsAlnum(Char) && Char < 128 ? Char : TEXT('_'));
+	}
+	if(Identifier.IsEmpty() || FChar::IsDigit(Identifier[0]) || Identifier[0] == TEXT('_'))
+	{
+		Identifier = TEXT("Row_") + Identifier;
+	}
+	if(Keywords.Contains(Identifier))
+	{
+		Identifier.AppendChar(TEXT('_'));
+	}
+
+	FString Unique = Identifier;
+	bOutSuffixed = false;
+	for (int32 Suffix = 2; UsedIdentifiers.Contains(Unique); ++Suffix)
+	{
+		Unique = FString::Printf(TEXT("%s_%d"), *Identifier, Suffix);
+		bOutSuffixed = true;
+	}
+	UsedIdentifiers.Add(Unique);
+	return Unique;
+}
+
+FString EasyDataTableRowName::Editor::FRowNameHeaderGenerator::EscapeString(const FString& Text)
+{
+	return Text.ReplaceCharWithEscapedChar();
+}
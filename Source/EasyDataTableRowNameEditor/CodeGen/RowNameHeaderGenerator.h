@@ -0,0 +1,51 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+class UDataTable;
+
+namespace EasyDataTableRowName::Editor
+{
+	enum class ERowNameHeaderResult : uint8
+	{
+		Written,
+		/** The header already matches the row set of the table */
+		UpToDate,
+		Failed,
+	};
+
+	/**
+	 * Writes a C++ header with the row names of a DataTable, so code referencing rows is checked by the compiler:
+	 * a constexpr ERow enum with dense indices, RowCount, and FName constants built once at static initialization.
+	 * The header records a hash of the row set and is only rewritten when that changes.
+	 * Headers are named after the table, a second table of the same name in another folder fails instead
+	 * of overwriting the header of the first while that one still exists.
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API FRowNameHeaderGenerator
+	{
+		public:
+			/** Header directory from the settings, absolute */
+			static FString GetDefaultOutputDirectory();
+			static FString GetHeaderPath(const UDataTable* Table, const FString& OutputDirectory);
+
+			static ERowNameHeaderResult Generate(const UDataTable* Table, const FString& OutputDirectory, bool bForce, FString& OutError);
+
+		private:
+			/** C++ identifiers differ by case, TSet<FString> alone would not */
+			struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<FString, FString>
+			{
+				static const FString& GetSetKey(const FString& Element) { return Element; }
+				static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+				static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+			};
+			using FIdentifierSet = TSet<FString, FCaseSensitiveKeyFuncs>;
+
+			static FString MakeHeader(const UDataTable* Table, const TArray<FName>& RowNames, const FString& RowSetHash);
+			static FString ComputeRowSetHash(const FString& TablePath, const TArray<FName>& RowNames);
+			/** Table path and row set hash recorded in an existing header, both empty when there is none */
+			static void ReadHeaderStamp(const FString& HeaderPath, FString& OutTablePath, FString& OutRowSetHash);
+			/** Valid, unique C++ identifier for Name, UsedIdentifiers collects the ones taken; bOutSuffixed when _2, _3... was added */
+			static FString MakeIdentifier(const FString& Name, FIdentifierSet& UsedIdentifiers, bool& bOutSuffixed);
+			static FString EscapeString(const FString& Text);
+	};
+}
@@ -0,0 +1,91 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameHeaderGeneratorMenu.h"
+
+#include "ContentBrowserMenuContexts.h"
+#include "RowNameHeaderGenerator.h"
+#include "ToolMenus.h"
+#include "Engine/DataTable.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#define LOCTEXT_NAMESPACE "EasyDataTableRowName"
+
+namespace EasyDataTableRowName::Editor
+{
+	static const FName CodeGenMenuOwnerName(TEXT("EasyDataTableRowNameCodeGen"));
+}
+
+FDelegateHandle EasyDataTableRowName::Editor::FRowNameHeaderGeneratorMenu::StartupCallbackHandle;
+
+void EasyDataTableRowName::Editor::FRowNameHeaderGeneratorMenu::Register()
+{
+	StartupCallbackHandle = UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateStatic(&FRowNameHeaderGeneratorMenu::RegisterMenus));
+}
+
+void EasyDataTableRowName::Editor::FRowNameHeaderGeneratorMenu::Unregister()
+{
+	if(UObjectInitialized())
+	{
+		UToolMenus::UnRegisterStartupCallback(StartupCallbackHandle);
+		UToolMenus::UnregisterOwner(CodeGenMenuOwnerName);
+	}
+	StartupCallbackHandle.Reset();
+}
+
+void EasyDataTableRowName::Editor::FRowNameHeaderGeneratorMenu::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(CodeGenMenuOwnerName);
+	UToolMenu* Menu = UToolMenus::Get()->ExtendMenu("ContentBrowser.AssetContextMenu.DataTable");
+	FToolMenuSection& Section = Menu->FindOrAddSection("GetAssetActions");
+	Section.AddDynamicEntry("EasyDataTableRowNameCodeGen", FNewToolMenuSectionDelegate::CreateLambda([](FToolMenuSection& InSection)
+	{
+		const UContentBrowserAssetContextMenuContext* Context = InSection.FindContext<UContentBrowserAssetContextMenuContext>();
+		if(Context == nullptr || Context->SelectedAssets.IsEmpty())
+		{
+			return;
+		}
+		InSection.AddMenuEntry(
+			"GenerateRowNameHeader",
+			LOCTEXT("GenerateRowNameHeader", "Generate Row Name Header"),
+			FText::Format(LOCTEXT("GenerateRowNameHeaderTooltip", "Write a C++ header with the row names of the selected tables to {0}"),
+				FText::FromString(FRowNameHeaderGenerator::GetDefaultOutputDirectory())),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateStatic(&FRowNameHeaderGeneratorMenu::GenerateHeaders, Context->SelectedAssets)));
+	}));
+}
+
+void EasyDataTableRowName::Editor::FRowNameHeaderGeneratorMenu::GenerateHeaders(TArray<FAssetData> TableAssets)
+{
+	const FString OutputDirectory = FRowNameHeaderGenerator::GetDefaultOutputDirectory();
+	int32 NumWritten = 0;
+	int32 NumUpToDate = 0;
+	TArray<FString> Errors;
+	for (const FAssetData& AssetData : TableAssets)
+	{
+		FString Error;
+		switch (FRowNameHeaderGenerator::Generate(Cast<UDataTable>(AssetData.GetAsset()), OutputDirectory, false, Error))
+		{
+		case ERowNameHeaderResult::Written:
+			++NumWritten;
+			break;
+		case ERowNameHeaderResult::UpToDate:
+			++NumUpToDate;
+			break;
+		case ERowNameHeaderResult::Failed:
+			Errors.Add(FString::Printf(TEXT("%s: %s"), *AssetData.AssetName.ToString(), *Error));
+			break;
+		}
+	}
+
+	FNotificationInfo Info(FText::Format(LOCTEXT("GenerateRowNameHeaderResult", "Row name headers: {0} written, {1} up to date"), NumWritten, NumUpToDate));
+	if(!Errors.IsEmpty())
+	{
+		Info.SubText = FText::FromString(FString::Join(Errors, TEXT("\n")));
+	}
+	Info.ExpireDuration = Errors.IsEmpty() ? 3.0f : 8.0f;
+	FSlateNotificationManager::Get().AddNotification(Info);
+}
+
+#undef LOCTEXT_NAMESPACE
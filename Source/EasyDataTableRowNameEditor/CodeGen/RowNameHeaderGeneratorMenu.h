@@ -0,0 +1,21 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	/** "Generate Row Name Header" entry of the DataTable asset context menu */
+	class FRowNameHeaderGeneratorMenu
+	{
+		public:
+			static void Register();
+			static void Unregister();
+
+		private:
+			static void RegisterMenus();
+			static void GenerateHeaders(TArray<FAssetData> TableAssets);
+
+			static FDelegateHandle StartupCallbackHandle;
+	};
+}
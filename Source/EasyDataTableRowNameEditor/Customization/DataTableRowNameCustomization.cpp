@@ -3,72 +3,107 @@
 
 #include "DataTableRowNameCustomization.h"
 
+#include "Batch/RowNameOptionsBatch.h"
 #include "DataTableEditorUtils.h"
 #include "DetailLayoutBuilder.h"
 #include "DetailWidgetRow.h"
+#include "IPropertyUtilities.h"
 #include "K2Node_Variable.h"
+#include "Misc/PackageName.h"
 #include "PropertyCustomizationHelpers.h"
+#include "RowNameSource/RowNameInheritance.h"
+#include "SRowNamePicker.h"
 #include "Selection.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "Editor/EditorWidgets/Public/SAssetDropTarget.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "Widgets/Input/SSearchBox.h"
 
 #define LOCTEXT_NAMESPACE "EasyDataTableRowName"
 
 FString EasyDataTableRowName::Editor::GetDataTableOptionsKey(const FProperty* Property)
 {
-	const FNameProperty* NameProperty = CastField<FNameProperty>(Property);
-	const FProperty* OwnerProperty = Property->GetOwnerProperty();
-	if(NameProperty == nullptr)
-	{
-		return FString();
-	}
-	
-	bool bIsInContainer = false;
-	bool bIsInMapContainer = false;
-	if(OwnerProperty != nullptr)
+	const FRowNameSourceRef Source = ResolveRowNameSource(Property);
+	return Source.IsValid() ? Source.SourcePath.ToString() : FString();
+}
+
+EasyDataTableRowName::Editor::FRowNameSourceRef EasyDataTableRowName::Editor::ResolveHandleRowNameSource(
+	const IPropertyHandle& Handle, TSharedPtr<IPropertyHandle>* OutMetaDataHandle)
+{
+	const FProperty* Property = Handle.GetProperty();
+	if(CastField<FNameProperty>(Property) == nullptr)
 	{
-		bIsInMapContainer |= CastField<FMapProperty>(OwnerProperty) != nullptr;
-		bIsInContainer |= CastField<FArrayProperty>(OwnerProperty) != nullptr;
-		bIsInContainer |= CastField<FSetProperty>(OwnerProperty) != nullptr;
+		return FRowNameSourceRef();
 	}
-	
-	FString DataTablePath;
-	if(bIsInMapContainer)
+
+	// Metadata sits on the container for Array / Set / Map elements
+	const FRowNameSourceRef Source = ResolveRowNameSource(Property);
+	if(Source.Provider.IsValid())
 	{
-		const FMapProperty* MapProperty = CastField<FMapProperty>(OwnerProperty);
-		if (MapProperty->HasMetaData(MD_KeyOptionsFromDataTable) && MapProperty->GetKeyProperty() == Property)
+		if(OutMetaDataHandle != nullptr)
 		{
-			DataTablePath = OwnerProperty->GetMetaData(MD_KeyOptionsFromDataTable);
+			*OutMetaDataHandle = Property->GetOwnerProperty() != nullptr ? Handle.GetParentHandle() : ConstCastSharedRef<IPropertyHandle>(Handle.AsShared());
 		}
+		return Source;
+	}
 
-		if (MapProperty->HasMetaData(MD_ValueOptionsFromDataTable) && MapProperty->GetValueProperty() == Property)
+	// Every element row repeats the same property pairs, FRowNameInheritance answers them from its cache
+	for (TSharedPtr<IPropertyHandle> Ancestor = Handle.GetParentHandle(); Ancestor.IsValid(); Ancestor = Ancestor->GetParentHandle())
+	{
+		const FRowNameSourceRef InheritedSource = FRowNameInheritance::Get().Resolve(Ancestor->GetProperty(), Property);
+		if(InheritedSource.Provider.IsValid())
 		{
-			DataTablePath = OwnerProperty->GetMetaData(MD_ValueOptionsFromDataTable);
+			if(OutMetaDataHandle != nullptr)
+			{
+				*OutMetaDataHandle = Ancestor;
+			}
+			return InheritedSource;
 		}
 	}
-	else
-	{
-		DataTablePath = bIsInContainer ? OwnerProperty->GetMetaData(MD_OptionsFromDataTable) : NameProperty->GetMetaData(MD_OptionsFromDataTable);
-	}
-	return DataTablePath;
+	return FRowNameSourceRef();
 }
 
 bool EasyDataTableRowName::Editor::FDataTableRowNamePropertyTypeIdentifier::IsPropertyTypeCustomized(
 	const IPropertyHandle& InPropertyHandle) const
 {
-	FProperty* Property = InPropertyHandle.GetProperty();
-	FString DataTablePath = GetDataTableOptionsKey(Property);
+	const FRowNameSourceRef Source = ResolveHandleRowNameSource(InPropertyHandle);
+
+	// The sibling property value is only known per instance, the picker resolves it itself
+	if(Source.IsDynamic())
+	{
+		return true;
+	}
 	
-	if(DataTablePath.IsEmpty())
+	if(!Source.IsValid())
 	{
 		return false;
 	}
 	
-	const UDataTable* DataTable = FindObject<UDataTable>(nullptr,*DataTablePath);
-	return ::IsValid(DataTable);
+	return ::IsValid(FRowNameIndexCache::Get().ResolveSourceObject(Source));
+}
+
+EasyDataTableRowName::Editor::DataTableRowNameCustomization::DataTableRowNameCustomization()
+{
+	FRowNameIndexCache::Get().AddMemoryReporter(this);
+}
+
+EasyDataTableRowName::Editor::DataTableRowNameCustomization::~DataTableRowNameCustomization()
+{
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	FRowNameIndexCache::Get().RemoveMemoryReporter(this);
+}
+
+FString EasyDataTableRowName::Editor::DataTableRowNameCustomization::GetMemoryReportName() const
+{
+	const FProperty* Property = NamePropertyHandle.IsValid() ? NamePropertyHandle->GetProperty() : nullptr;
+	return FString::Printf(TEXT("Customization %s -> %s"), Property != nullptr ? *Property->GetPathName() : TEXT("?"),
+		*RowNameSource.SourcePath.ToString());
+}
+
+SIZE_T EasyDataTableRowName::Editor::DataTableRowNameCustomization::GetAllocatedSize() const
+{
+	return sizeof(DataTableRowNameCustomization) + RowNameSource.RowFilter.GetAllocatedSize()
+		+ RowNameSource.DisplayField.GetAllocatedSize() + OuterObjects.GetAllocatedSize();
 }
 
 TSharedRef<IPropertyTypeCustomization> EasyDataTableRowName::Editor::DataTableRowNameCustomization::MakeInstance()
@@ -84,10 +119,14 @@ void EasyDataTableRowName::Editor::DataTableRowNameCustomization::CustomizeHeade
 	// 在使用句柄之前，检查句柄是否为空
 	check(NamePropertyHandle.IsValid());
 	
-	AllRowNames = GetAllRowNames();
+	// The name list is only read once the combo opens
+	RowNameSource = ResolveHandleRowNameSource(*NamePropertyHandle, &MetaDataHandle);
+	if(RowNameSource.IsDynamic())
+	{
+		BindDynamicSource();
+	}
 
 	SAssignNew(ComboButton, SComboButton)
-		.OnComboBoxOpened(this, &DataTableRowNameCustomization::OnComboBoxOpened)
 		.OnGetMenuContent(this, &DataTableRowNameCustomization::GeneratePropertyList)
 		.ContentPadding(FMargin(2.0f, 2.0f))
 		.ButtonContent()
@@ -129,23 +168,6 @@ void EasyDataTableRowName::Editor::DataTableRowNameCustomization::CustomizeChild
 	
 }
 
-TArray<TSharedPtr<FName>> EasyDataTableRowName::Editor::DataTableRowNameCustomization::GetAllRowNames()
-{
-	TArray<TSharedPtr<FName>> OutNames;
-	OutNames.Add(MakeShared<FName>(NAME_None));
-	const UDataTable* DataTable = GetOriginDataTable();
-	if(!IsValid(DataTable))
-	{
-		return OutNames;
-	}
-	for (const FName& RowName : DataTable->GetRowNames())
-	{
-		OutNames.Add(MakeShared<FName>(RowName));
-	}
-	
-	return OutNames;
-}
-
 FText EasyDataTableRowName::Editor::DataTableRowNameCustomization::GetSelectedPropertyName() const
 {
 	FName CurrentSelectedValue;
@@ -156,114 +178,128 @@ FText EasyDataTableRowName::Editor::DataTableRowNameCustomization::GetSelectedPr
 
 TSharedRef<SWidget> EasyDataTableRowName::Editor::DataTableRowNameCustomization::GeneratePropertyList()
 {
-	return SNew(SBox)
-		.WidthOverride(280)
-		[
-			SNew(SVerticalBox)
-			.Visibility(EVisibility::SelfHitTestInvisible)
-			+ SVerticalBox::Slot()
-			.HAlign(EHorizontalAlignment::HAlign_Fill)
-			.VAlign(EVerticalAlignment::VAlign_Fill)
-			.AutoHeight()
-			.Padding(5.0)
-			[
-				SNew(SSearchBox)
-				.OnTextChanged(this,&DataTableRowNameCustomization::OnSearchTextChanged)
-			]
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			.MaxHeight(500)
-			[
-				SAssignNew(ComboContainer,SListView<TSharedPtr<FName>>)
-				.Visibility(EVisibility::Visible)
-				.ListItemsSource(&AllRowNames)
-				.OnGenerateRow(this, &DataTableRowNameCustomization::OnGenerateRowForPropertyName)
-				.OnSelectionChanged(this, &DataTableRowNameCustomization::OnPropertyNameSelectionChanged)
-			]
-		];
+	TSharedRef<SRowNamePicker> Picker = SNew(SRowNamePicker)
+		.RowNameSource(RowNameSource)
+		.OnRowNameSelected(this, &DataTableRowNameCustomization::OnPropertyNameSelected);
+	ComboButton->SetMenuContentWidgetToFocus(Picker->GetWidgetToFocus());
+	return Picker;
 }
 
-void EasyDataTableRowName::Editor::DataTableRowNameCustomization::OnPropertyNameSelectionChanged(TSharedPtr<FName> Item,
-	ESelectInfo::Type SelectInfo)
+void EasyDataTableRowName::Editor::DataTableRowNameCustomization::OnPropertyNameSelected(const FName& RowName)
 {
-	SelectedPropertyName = *Item.Get();
+	SelectedPropertyName = RowName;
 	NamePropertyHandle->SetValue(SelectedPropertyName);
 	ComboButton->SetIsOpen(false);
 }
 
-TSharedRef<ITableRow> EasyDataTableRowName::Editor::DataTableRowNameCustomization::OnGenerateRowForPropertyName(
-	TSharedPtr<FName> Item, const TSharedRef<STableViewBase>& OwnerTable)
-{
-	TSharedRef<ITableRow> ReturnRow = SNew(STableRow<TSharedPtr<FName>>, OwnerTable)
-	   [
-		  SNew(STextBlock)
-		  .Text(FText::FromName(*Item.Get()))
-	   ];
-
-	return ReturnRow;
-}
-
 void EasyDataTableRowName::Editor::DataTableRowNameCustomization::OnBrowseTo()
 {
-	UDataTable* DataTable = GetOriginDataTable();
-	if(IsValid(DataTable))
+	UObject* SourceObject = GetRowNameSourceObject();
+	if(IsValid(SourceObject))
 	{
-		GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(DataTable);
 		FName CurrentSelectedValue;
 		NamePropertyHandle->GetValue(CurrentSelectedValue);
-		if(DataTable->GetRowMap().Contains(CurrentSelectedValue))
-		{
-			FDataTableEditorUtils::SelectRow(DataTable,CurrentSelectedValue);
-		}
+		RowNameSource.Provider->BrowseToRow(SourceObject, CurrentSelectedValue);
 	}
 }
 
-void EasyDataTableRowName::Editor::DataTableRowNameCustomization::OnSearchTextChanged(const FText& Text)
+UObject* EasyDataTableRowName::Editor::DataTableRowNameCustomization::GetRowNameSourceObject() const
+{
+	return FRowNameIndexCache::Get().ResolveSourceObject(RowNameSource);
+}
+
+void EasyDataTableRowName::Editor::DataTableRowNameCustomization::BindDynamicSource()
 {
-	if(!ComboContainer.IsValid())
+	TSharedPtr<IPropertyHandle> OwnerHandle = MetaDataHandle.IsValid() ? MetaDataHandle->GetParentHandle() : nullptr;
+	if(OwnerHandle.IsValid())
 	{
-		return;
+		SourcePropertyHandle = OwnerHandle->GetChildHandle(RowNameSource.SourcePropertyName);
 	}
-	FString SearchString = Text.ToString();
-	if(SearchString.Len() > 0)
+
+	if(SourcePropertyHandle.IsValid() && SourcePropertyHandle->IsValidHandle())
 	{
-		AllRowNames = GetAllRowNames();
-		AllRowNames = AllRowNames.FilterByPredicate([&SearchString](TSharedPtr<FName> Item)
-		{
-			return Item.Get()->ToString().Find(SearchString) != INDEX_NONE;
-		});
+		SourcePropertyHandle->SetOnPropertyValueChanged(FSimpleDelegate::CreateSP(this, &DataTableRowNameCustomization::OnSourcePropertyChanged));
 	}
 	else
 	{
-		AllRowNames = GetAllRowNames();
+		SourcePropertyHandle.Reset();
+		TArray<UObject*> Objects;
+		NamePropertyHandle->GetOuterObjects(Objects);
+		OuterObjects.Append(Objects);
+		ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddSP(this, &DataTableRowNameCustomization::OnObjectPropertyChanged);
+	}
+	ResolveDynamicSourcePath();
+}
+
+void EasyDataTableRowName::Editor::DataTableRowNameCustomization::ResolveDynamicSourcePath()
+{
+	RowNameSource.SourcePath.Reset();
+	if(SourcePropertyHandle.IsValid())
+	{
+		FString Value;
+		if(SourcePropertyHandle->GetValueAsFormattedString(Value) == FPropertyAccess::Success)
+		{
+			RowNameSource.SourcePath = FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(Value));
+		}
+		return;
+	}
+
+	// Objects disagreeing on the source get no names, like a multiple values property row
+	bool bFirst = true;
+	for (const TWeakObjectPtr<UObject>& WeakObject : OuterObjects)
+	{
+		const UObject* Object = WeakObject.Get();
+		const FObjectPropertyBase* SourceProperty = Object != nullptr ? FindFProperty<FObjectPropertyBase>(Object->GetClass(), RowNameSource.SourcePropertyName) : nullptr;
+		if(SourceProperty == nullptr)
+		{
+			continue;
+		}
+		const FSoftObjectPath Path(SourceProperty->GetObjectPropertyValue_InContainer(Object));
+		if(!bFirst && Path != RowNameSource.SourcePath)
+		{
+			RowNameSource.SourcePath.Reset();
+			return;
+		}
+		RowNameSource.SourcePath = Path;
+		bFirst = false;
 	}
-	ComboContainer->RebuildList();
 }
 
-void EasyDataTableRowName::Editor::DataTableRowNameCustomization::OnComboBoxOpened()
+void EasyDataTableRowName::Editor::DataTableRowNameCustomization::OnSourcePropertyChanged()
 {
-	AllRowNames = GetAllRowNames();
+	// Only this picker depends on the sibling, no need to rebuild the details panel
+	ResolveDynamicSourcePath();
+	if(ComboButton.IsValid())
+	{
+		ComboButton->SetIsOpen(false);
+	}
 }
 
-UDataTable* EasyDataTableRowName::Editor::DataTableRowNameCustomization::GetOriginDataTable()
+void EasyDataTableRowName::Editor::DataTableRowNameCustomization::OnObjectPropertyChanged(UObject* Object,
+	FPropertyChangedEvent& PropertyChangedEvent)
 {
-	FProperty* Property = NamePropertyHandle->GetProperty();
-	FString DataTablePath = GetDataTableOptionsKey(Property);
-	
-	if(DataTablePath.IsEmpty())
+	if(PropertyChangedEvent.GetPropertyName() != RowNameSource.SourcePropertyName)
 	{
-		return nullptr;
+		return;
+	}
+	if(OuterObjects.Contains(Object))
+	{
+		OnSourcePropertyChanged();
 	}
-	
-	return FindObject<UDataTable>(nullptr,*DataTablePath);
 }
 
 void EasyDataTableRowName::Editor::SDataTablePathSelector::Construct(const FArguments& InArgs)
 {
 	TSharedPtr<SHorizontalBox> ValueContentBox = nullptr;
-	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
-	CachedAssetData = AssetRegistry.GetAssetByObjectPath(InArgs._CachedPath);
+	// The asset registry is only queried once the asset data is actually needed
+	CachedPath = InArgs._CachedPath;
+	bCachedAssetDataResolved = CachedPath.IsNull();
 	OnPathChanged = InArgs._OnPathChanged;
+	AllowedClasses = InArgs._AllowedClasses;
+	if(AllowedClasses.IsEmpty())
+	{
+		AllowedClasses = FRowNameSourceProviderRegistry::Get().GetSourceClasses();
+	}
 	ChildSlot
 	[
 		SNew( SAssetDropTarget )
@@ -359,19 +395,13 @@ bool EasyDataTableRowName::Editor::SDataTablePathSelector::OnAssetDraggedOver(TA
 	{
 		return false;
 	}
-	UObject* AssetObject = InAssets[0].GetAsset();
-	if(!IsValid(AssetObject))
-	{
-		return false;
-	}
-	return AssetObject->IsA(UDataTable::StaticClass());
+	return IsAllowedAsset(InAssets[0].GetAsset());
 }
 
 void EasyDataTableRowName::Editor::SDataTablePathSelector::OnAssetDropped(const FDragDropEvent&,
 	TArrayView<FAssetData> InAssets)
 {
-	UDataTable* AssetObject = Cast<UDataTable>(InAssets[0].GetAsset());
-	if(IsValid(AssetObject))
+	if(IsAllowedAsset(InAssets[0].GetAsset()))
 	{
 		SetValue(InAssets[0]);
 	}
@@ -379,12 +409,10 @@ void EasyDataTableRowName::Editor::SDataTablePathSelector::OnAssetDropped(const
 
 TSharedRef<SWidget> EasyDataTableRowName::Editor::SDataTablePathSelector::OnGetMenuContent()
 {
-	TArray<const UClass*> AllowedClassList;
 	TArray<UFactory*> Factory;
-	AllowedClassList.Add(UDataTable::StaticClass());
-	return PropertyCustomizationHelpers::MakeAssetPickerWithMenu(CachedAssetData,
+	return PropertyCustomizationHelpers::MakeAssetPickerWithMenu(GetCachedAssetData(),
 																	 true,
-																	 AllowedClassList,
+																	 AllowedClasses,
 																	 Factory,
 																	 FOnShouldFilterAsset::CreateSP(this,&SDataTablePathSelector::OnShouldFilterAsset),
 																	 FOnAssetSelected::CreateSP(this, &SDataTablePathSelector::OnAssetSelected),
@@ -417,7 +445,7 @@ void EasyDataTableRowName::Editor::SDataTablePathSelector::CloseComboButton()
 
 FText EasyDataTableRowName::Editor::SDataTablePathSelector::OnGetAssetName() const
 {
-	return FText::FromName(CachedAssetData.AssetName);
+	return FText::FromString(CachedPath.GetAssetName());
 }
 
 void EasyDataTableRowName::Editor::SDataTablePathSelector::OnUse()
@@ -428,7 +456,14 @@ void EasyDataTableRowName::Editor::SDataTablePathSelector::OnUse()
 	// try to get a selected object of our class
 	const UObject* Selection = nullptr;
 	
-	Selection = GEditor->GetSelectedObjects()->GetTop( UDataTable::StaticClass() );
+	for (const UClass* AllowedClass : AllowedClasses)
+	{
+		Selection = GEditor->GetSelectedObjects()->GetTop( const_cast<UClass*>(AllowedClass) );
+		if( Selection )
+		{
+			break;
+		}
+	}
 
 	if( Selection )
 	{
@@ -439,7 +474,7 @@ void EasyDataTableRowName::Editor::SDataTablePathSelector::OnUse()
 void EasyDataTableRowName::Editor::SDataTablePathSelector::OnBrowse()
 {
 	TArray<FAssetData> AssetDataList;
-	AssetDataList.Add( CachedAssetData );
+	AssetDataList.Add( GetCachedAssetData() );
 	GEditor->SyncBrowserToObjects( AssetDataList );
 }
 
@@ -454,18 +489,49 @@ void EasyDataTableRowName::Editor::SDataTablePathSelector::SetValue(const FAsset
 	if(!IsValid(AssetObject))
 	{
 		CachedAssetData = FAssetData();
+		CachedPath.Reset();
+		bCachedAssetDataResolved = true;
 		OnPathChanged.ExecuteIfBound(FSoftObjectPath());
 		return;
 	}
-	if(AssetObject->IsA(UDataTable::StaticClass()))
+	if(IsAllowedAsset(AssetObject))
 	{
 		AssetComboButton->SetIsOpen(false);
 		CachedAssetData = AssetData;
+		CachedPath = AssetData.GetSoftObjectPath();
+		bCachedAssetDataResolved = true;
 		OnPathChanged.ExecuteIfBound(AssetData.GetSoftObjectPath());
 	}
 	
 }
 
+const FAssetData& EasyDataTableRowName::Editor::SDataTablePathSelector::GetCachedAssetData() const
+{
+	if(!bCachedAssetDataResolved)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		CachedAssetData = AssetRegistry.GetAssetByObjectPath(CachedPath);
+		bCachedAssetDataResolved = true;
+	}
+	return CachedAssetData;
+}
+
+bool EasyDataTableRowName::Editor::SDataTablePathSelector::IsAllowedAsset(const UObject* AssetObject) const
+{
+	if(!IsValid(AssetObject))
+	{
+		return false;
+	}
+	for (const UClass* AllowedClass : AllowedClasses)
+	{
+		if(AssetObject->IsA(AllowedClass))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 TSharedPtr<IDetailCustomization> EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::MakeInstance(
 	TSharedPtr<IBlueprintEditor> InBlueprintEditor)
 {
@@ -482,6 +548,10 @@ TSharedPtr<IDetailCustomization> EasyDataTableRowName::Editor::DataTableRowNameB
 
 UK2Node_Variable* EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::EdGraphSelectionAsVar() const
 {
+	if(!MyBlueprint.IsValid())
+	{
+		return nullptr;
+	}
 	TWeakPtr<FBlueprintEditor> BlueprintEditor = MyBlueprint.Pin()->GetBlueprintEditor();
 
 	if( BlueprintEditor.IsValid() )
@@ -534,6 +604,10 @@ bool EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::IsABlu
 
 FProperty* EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::SelectionAsProperty() const
 {
+	if(!MyBlueprint.IsValid())
+	{
+		return nullptr;
+	}
 	if (FEdGraphSchemaAction_BlueprintVariableBase* BPVar = MyBlueprint.Pin()->SelectionAsBlueprintVariable())
 	{
 		return BPVar->GetProperty();
@@ -548,6 +622,10 @@ FProperty* EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::
 
 FName EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::GetVariableName() const
 {
+	if(!MyBlueprint.IsValid())
+	{
+		return NAME_None;
+	}
 	if (FEdGraphSchemaAction_BlueprintVariableBase* BPVar = MyBlueprint.Pin()->SelectionAsBlueprintVariable())
 	{
 		return BPVar->GetVariableName();
@@ -564,11 +642,26 @@ void EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::OnPost
 {
 	CachedVariableProperty = SelectionAsProperty();
 	CachedVariableName = GetVariableName();
+
+	// Rows are only built for visible selectors, so a changed variable type needs a rebuild
+	const FOptionsVisibility NewVisibility = ComputeOptionsVisibility();
+	if(NewVisibility != CachedOptionsVisibility)
+	{
+		CachedOptionsVisibility = NewVisibility;
+		if(TSharedPtr<IPropertyUtilities> Utilities = PropertyUtilities.Pin())
+		{
+			Utilities->ForceRefresh();
+		}
+	}
 }
 
 UBlueprint* EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::GetPropertyOwnerBlueprint() const
 {
 	FProperty* VariableProperty = CachedVariableProperty.Get();
+	if(VariableProperty == nullptr)
+	{
+		return nullptr;
+	}
 
 	// Cache the Blueprint which owns this VariableProperty
 	if (UBlueprintGeneratedClass* GeneratedClass = Cast<UBlueprintGeneratedClass>(VariableProperty->GetOwnerClass()))
@@ -581,6 +674,23 @@ UBlueprint* EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization:
 EVisibility EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::
 GetDataTableRowNameBPEditorVisibility() const
 {
+	return CachedOptionsVisibility.IsAnyVisible() ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::FOptionsVisibility EasyDataTableRowName::Editor::
+DataTableRowNameBPEditorCustomization::ComputeOptionsVisibility() const
+{
+	FOptionsVisibility Visibility;
+	Visibility.bKey = ShouldKeyOptionsShow();
+	Visibility.bValue = ShouldValueOptionsShow();
+	Visibility.bCommon = ShouldNameOptionsShow();
+
+	// Plain casts above reject most variables before the pin type conversion below
+	if(!Visibility.IsAnyVisible())
+	{
+		return Visibility;
+	}
+
 	FProperty* VariableProperty = CachedVariableProperty.Get();
 	// Cache the Blueprint which owns this VariableProperty
 	if (VariableProperty && GetPropertyOwnerBlueprint())
@@ -593,22 +703,10 @@ GetDataTableRowNameBPEditorVisibility() const
 		FObjectPropertyBase* ObjectProperty  = CastField<FObjectPropertyBase>(VariableProperty);
 		if (!bShowPrivacySetting || (K2Schema->FindSetVariableByNameFunction(VariablePinType) == NULL) || ObjectProperty != nullptr)
 		{
-			return EVisibility::Collapsed;
+			return FOptionsVisibility();
 		}
 	}
-	if(ShouldKeyOptionsShow())
-	{
-		return EVisibility::Visible;
-	}
-	if(ShouldValueOptionsShow())
-	{
-		return EVisibility::Visible;
-	}
-	if(ShouldNameOptionsShow())
-	{
-		return EVisibility::Visible;
-	}
-	return EVisibility::Collapsed;
+	return Visibility;
 }
 
 bool EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::ShouldKeyOptionsShow() const
@@ -658,52 +756,36 @@ bool EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::Should
 	return false;
 }
 
-void EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::OnKeyPathChanged(const FSoftObjectPath& Path)
-{
-	const FName VarName = CachedVariableName;
-	FBlueprintEditorUtils::SetBlueprintVariableMetaData(GetBlueprintObj(), VarName, nullptr, MD_KeyOptionsFromDataTable, Path.ToString());
-}
-
-EVisibility EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::KeyPathSelectorVisibility() const
+FSoftObjectPath EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::GetOptionsPath(
+	ERowNameOptionsSlot Slot) const
 {
-	if(ShouldKeyOptionsShow())
-	{
-		return EVisibility::Visible;
-	}
-	return EVisibility::Collapsed;
+	return FRowNameSourceProviderRegistry::Get().FindSourceMetaData(CachedVariableProperty.Get(), Slot).SourcePath;
 }
 
-EVisibility EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::ValuePathSelectorVisibility() const
+void EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::SetOptionsPath(ERowNameOptionsSlot Slot,
+	const FSoftObjectPath& Path)
 {
-	if(ShouldValueOptionsShow())
-	{
-		return EVisibility::Visible;
-	}
-	return EVisibility::Collapsed;
+	// One modify for all provider keys of the slot, the compile is left to the user as before
+	FRowNameOptionsBatch Batch;
+	Batch.Assign(GetBlueprintObj(), CachedVariableName, Slot, Path);
+	Batch.Apply(LOCTEXT("SetOptionsPath", "Set Row Name Options Source"), false);
 }
 
-EVisibility EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::CommonPathSelectorVisibility() const
+void EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::OnKeyPathChanged(const FSoftObjectPath& Path)
 {
-	if(ShouldNameOptionsShow())
-	{
-		return EVisibility::Visible;
-	}
-	return EVisibility::Collapsed;
+	SetOptionsPath(ERowNameOptionsSlot::Key, Path);
 }
 
 void EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::OnValuePathChanged(
 	const FSoftObjectPath& Path)
 {
-	const FName VarName = CachedVariableName;
-	FBlueprintEditorUtils::SetBlueprintVariableMetaData(GetBlueprintObj(), VarName, nullptr, MD_ValueOptionsFromDataTable, Path.ToString());
-
+	SetOptionsPath(ERowNameOptionsSlot::Value, Path);
 }
 
 void EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::OnCommonPathChanged(
 	const FSoftObjectPath& Path)
 {
-	const FName VarName = CachedVariableName;
-	FBlueprintEditorUtils::SetBlueprintVariableMetaData(GetBlueprintObj(), VarName, nullptr, MD_OptionsFromDataTable, Path.ToString());
+	SetOptionsPath(ERowNameOptionsSlot::Common, Path);
 }
 
 void EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::CustomizeDetails(
@@ -716,62 +798,81 @@ void EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::Custom
 		return;
 	}
 
+	// Runs for every variable selection, leave before touching any widget or the asset registry
+	CachedOptionsVisibility = ComputeOptionsVisibility();
+	if(!CachedOptionsVisibility.IsAnyVisible())
+	{
+		return;
+	}
+
 	CachedVariableName = GetVariableName();
+	PropertyUtilities = DetailBuilder.GetPropertyUtilities();
+
+	if(!bRefreshBound && MyBlueprint.IsValid())
+	{
+		TWeakPtr<FBlueprintEditor> BlueprintEditor = MyBlueprint.Pin()->GetBlueprintEditor();
+		if( BlueprintEditor.IsValid() )
+		{
+			BlueprintEditor.Pin()->OnRefresh().AddSP(this, &DataTableRowNameBPEditorCustomization::OnPostEditorRefresh);
+			bRefreshBound = true;
+		}
+	}
 	
 	IDetailCategoryBuilder& Category = DetailBuilder.EditCategory("Name Options From Datatable",FText::GetEmpty(),ECategoryPriority::TypeSpecific);
-	Category.SetCategoryVisibility(GetDataTableRowNameBPEditorVisibility() == EVisibility::Visible);
-	
-	FProperty* VariableProperty = CachedVariableProperty.Get();
-
-	Category.AddCustomRow(LOCTEXT("EasyDataTableRowName", "Set Key Options DataTable"))
-		.NameContent()
-		[
-			SNew(STextBlock)
-			.ToolTipText(LOCTEXT("EasyDataTableRowName", "Set Key Options DataTable"))
-			.Text( LOCTEXT("EasyDataTableRowName", "Set Key Options DataTable"))
-			.Font( IDetailLayoutBuilder::GetDetailFontBold() )
-		]
-		.ValueContent()
-		[
-			SAssignNew(KeyDataTableSelector,SDataTablePathSelector)
-			.CachedPath(FSoftObjectPath(CachedVariableProperty->GetMetaData(MD_KeyOptionsFromDataTable)))
-			.OnPathChanged(FOnPathChanged::CreateSP(this,&DataTableRowNameBPEditorCustomization::OnKeyPathChanged))
-		]
-		.Visibility(TAttribute<EVisibility>(this, &DataTableRowNameBPEditorCustomization::KeyPathSelectorVisibility));
 
-	Category.AddCustomRow(LOCTEXT("EasyDataTableRowName", "Set Value Options DataTable"))
-		.NameContent()
-		[
-			SNew(STextBlock)
-			.ToolTipText(LOCTEXT("EasyDataTableRowName", "Set Value Options DataTable"))
-			.Text( LOCTEXT("EasyDataTableRowName", "Set Value Options DataTable"))
-			.Font( IDetailLayoutBuilder::GetDetailFontBold() )
-		]
-		.ValueContent()
-		[
-			SAssignNew(ValueDataTableSelector,SDataTablePathSelector)
-			.CachedPath(FSoftObjectPath(CachedVariableProperty->GetMetaData(MD_ValueOptionsFromDataTable)))
-			.OnPathChanged(FOnPathChanged::CreateSP(this,&DataTableRowNameBPEditorCustomization::OnValuePathChanged))
-		]
-		.Visibility(TAttribute<EVisibility>(this, &DataTableRowNameBPEditorCustomization::ValuePathSelectorVisibility));
+	if(CachedOptionsVisibility.bKey)
+	{
+		Category.AddCustomRow(LOCTEXT("EasyDataTableRowName", "Set Key Options DataTable"))
+			.NameContent()
+			[
+				SNew(STextBlock)
+				.ToolTipText(LOCTEXT("EasyDataTableRowName", "Set Key Options DataTable"))
+				.Text( LOCTEXT("EasyDataTableRowName", "Set Key Options DataTable"))
+				.Font( IDetailLayoutBuilder::GetDetailFontBold() )
+			]
+			.ValueContent()
+			[
+				SAssignNew(KeyDataTableSelector,SDataTablePathSelector)
+				.CachedPath(GetOptionsPath(ERowNameOptionsSlot::Key))
+				.OnPathChanged(FOnPathChanged::CreateSP(this,&DataTableRowNameBPEditorCustomization::OnKeyPathChanged))
+			];
+	}
 
-	Category.AddCustomRow(LOCTEXT("EasyDataTableRowName", "Set Common Options DataTable"))
-		.NameContent()
-		[
-			SNew(STextBlock)
-			.ToolTipText(LOCTEXT("EasyDataTableRowName", "Set Common Options DataTable"))
-			.Text( LOCTEXT("EasyDataTableRowName", "Set Common Options DataTable"))
-			.Font( IDetailLayoutBuilder::GetDetailFontBold() )
-		]
-		.ValueContent()
-		[
-			SAssignNew(CommonDataTableSelector,SDataTablePathSelector)
-			.CachedPath(FSoftObjectPath(CachedVariableProperty->GetMetaData(MD_OptionsFromDataTable)))
-			.OnPathChanged(FOnPathChanged::CreateSP(this,&DataTableRowNameBPEditorCustomization::OnCommonPathChanged))
-		]
-		.Visibility(TAttribute<EVisibility>(this, &DataTableRowNameBPEditorCustomization::CommonPathSelectorVisibility));
+	if(CachedOptionsVisibility.bValue)
+	{
+		Category.AddCustomRow(LOCTEXT("EasyDataTableRowName", "Set Value Options DataTable"))
+			.NameContent()
+			[
+				SNew(STextBlock)
+				.ToolTipText(LOCTEXT("EasyDataTableRowName", "Set Value Options DataTable"))
+				.Text( LOCTEXT("EasyDataTableRowName", "Set Value Options DataTable"))
+				.Font( IDetailLayoutBuilder::GetDetailFontBold() )
+			]
+			.ValueContent()
+			[
+				SAssignNew(ValueDataTableSelector,SDataTablePathSelector)
+				.CachedPath(GetOptionsPath(ERowNameOptionsSlot::Value))
+				.OnPathChanged(FOnPathChanged::CreateSP(this,&DataTableRowNameBPEditorCustomization::OnValuePathChanged))
+			];
+	}
 
-	
+	if(CachedOptionsVisibility.bCommon)
+	{
+		Category.AddCustomRow(LOCTEXT("EasyDataTableRowName", "Set Common Options DataTable"))
+			.NameContent()
+			[
+				SNew(STextBlock)
+				.ToolTipText(LOCTEXT("EasyDataTableRowName", "Set Common Options DataTable"))
+				.Text( LOCTEXT("EasyDataTableRowName", "Set Common Options DataTable"))
+				.Font( IDetailLayoutBuilder::GetDetailFontBold() )
+			]
+			.ValueContent()
+			[
+				SAssignNew(CommonDataTableSelector,SDataTablePathSelector)
+				.CachedPath(GetOptionsPath(ERowNameOptionsSlot::Common))
+				.OnPathChanged(FOnPathChanged::CreateSP(this,&DataTableRowNameBPEditorCustomization::OnCommonPathChanged))
+			];
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
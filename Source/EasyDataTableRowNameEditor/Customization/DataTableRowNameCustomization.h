@@ -5,6 +5,7 @@
 #include "IDetailCustomization.h"
 #include "IPropertyTypeCustomization.h"
 #include "SMyBlueprint.h"
+#include "RowNameSource/RowNameIndexCache.h"
 
 namespace EasyDataTableRowName::Editor
 {
@@ -16,7 +17,14 @@ namespace EasyDataTableRowName::Editor
 	DECLARE_DELEGATE_OneParam(FOnPathChanged, const FSoftObjectPath&);
 
 	
+	/** Path of the row name source asset of Property, whichever provider it belongs to */
 	FString GetDataTableOptionsKey(const FProperty* Property);
+
+	/**
+	 * Source of the FName behind Handle: its own or its container's metadata, else the nearest enclosing
+	 * property passing its metadata down (see FRowNameInheritance). OutMetaDataHandle receives the tagged handle.
+	 */
+	FRowNameSourceRef ResolveHandleRowNameSource(const IPropertyHandle& Handle, TSharedPtr<IPropertyHandle>* OutMetaDataHandle = nullptr);
 	
 	class FDataTableRowNamePropertyTypeIdentifier : public IPropertyTypeIdentifier
 	{
@@ -24,33 +32,46 @@ namespace EasyDataTableRowName::Editor
 			virtual bool IsPropertyTypeCustomized(const IPropertyHandle& InPropertyHandle) const override;
 	};
 
-	class EASYDATATABLEROWNAMEEDITOR_API DataTableRowNameCustomization: public IPropertyTypeCustomization
+	class EASYDATATABLEROWNAMEEDITOR_API DataTableRowNameCustomization: public IPropertyTypeCustomization, public IRowNameMemoryReporter
 	{
 		public:
+			DataTableRowNameCustomization();
+			virtual ~DataTableRowNameCustomization() override;
+
 			static TSharedRef<IPropertyTypeCustomization> MakeInstance();
 			virtual void CustomizeHeader( TSharedRef<IPropertyHandle> PropertyHandle, FDetailWidgetRow& HeaderRow, IPropertyTypeCustomizationUtils& CustomizationUtils ) override;
 			virtual void CustomizeChildren( TSharedRef<IPropertyHandle> PropertyHandle, IDetailChildrenBuilder& ChildBuilder, IPropertyTypeCustomizationUtils& CustomizationUtils ) override;
 
+			virtual FString GetMemoryReportName() const override;
+			virtual SIZE_T GetAllocatedSize() const override;
+
 		private:
-			TArray<TSharedPtr<FName>> GetAllRowNames();
-		
 			FText GetSelectedPropertyName() const;
 			TSharedRef<SWidget> GeneratePropertyList();
-			void OnPropertyNameSelectionChanged(TSharedPtr<FName> Item,ESelectInfo::Type SelectInfo);
-			TSharedRef<ITableRow> OnGenerateRowForPropertyName(TSharedPtr<FName> Item,const TSharedRef<STableViewBase>& OwnerTable);
+			void OnPropertyNameSelected(const FName& RowName);
 			void OnBrowseTo();
 
 		protected:
-			void OnSearchTextChanged(const FText& Text);
-			void OnComboBoxOpened();
+			UObject* GetRowNameSourceObject() const;
 
-		protected:
-			UDataTable* GetOriginDataTable();
+			/** Reads the sibling source property of an OptionsFromProperty source and tracks its changes */
+			void BindDynamicSource();
+			void ResolveDynamicSourcePath();
+			void OnSourcePropertyChanged();
+			void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
 			
 		private:
 
-			TArray<TSharedPtr<FName>> AllRowNames;
-			TSharedPtr<SListView<TSharedPtr<FName>>> ComboContainer;
+			FRowNameSourceRef RowNameSource;
+			/** Handle carrying the row name metadata, the sibling of a dynamic source is next to it */
+			TSharedPtr<IPropertyHandle> MetaDataHandle;
+
+			/** Sibling handle of a dynamic source, when the details tree exposes it */
+			TSharedPtr<IPropertyHandle> SourcePropertyHandle;
+			/** Fallback for top level siblings the tree does not expose, filtered by outer object and name */
+			FDelegateHandle ObjectPropertyChangedHandle;
+			TArray<TWeakObjectPtr<UObject>> OuterObjects;
+
 			FName SelectedPropertyName = FName("None");
 		
 			TSharedPtr<SComboButton> ComboButton;
@@ -63,6 +84,8 @@ namespace EasyDataTableRowName::Editor
 		SLATE_BEGIN_ARGS(SDataTablePathSelector)
 			{}
 			SLATE_ARGUMENT(FSoftObjectPath, CachedPath)
+			/** Asset classes that can be picked, every registered row name source class when empty */
+			SLATE_ARGUMENT(TArray<const UClass*>, AllowedClasses)
 			SLATE_EVENT(FOnPathChanged, OnPathChanged)
 
 		SLATE_END_ARGS()
@@ -85,13 +108,18 @@ namespace EasyDataTableRowName::Editor
 			void OnBrowse();
 			void OnClear();
 			void SetValue( const FAssetData& AssetData );
+			bool IsAllowedAsset( const UObject* AssetObject ) const;
+			const FAssetData& GetCachedAssetData() const;
 
 		protected:
 			FOnPathChanged OnPathChanged;
 		
 		protected:
 			TSharedPtr<SComboButton> AssetComboButton;
+			FSoftObjectPath CachedPath;
 			mutable FAssetData CachedAssetData;
+			mutable bool bCachedAssetDataResolved = false;
+			TArray<const UClass*> AllowedClasses;
 			int32 NumButtons = 0;
 	};
 
@@ -99,6 +127,20 @@ namespace EasyDataTableRowName::Editor
 
 	class DataTableRowNameBPEditorCustomization  : public IDetailCustomization
 	{
+		protected:
+			/** Which path selectors the selected variable needs, computed once per selection or refresh */
+			struct FOptionsVisibility
+			{
+				bool bKey = false;
+				bool bValue = false;
+				bool bCommon = false;
+
+				bool IsAnyVisible() const { return bKey || bValue || bCommon; }
+				bool operator!=(const FOptionsVisibility& Other) const
+				{
+					return bKey != Other.bKey || bValue != Other.bValue || bCommon != Other.bCommon;
+				}
+			};
 	
 		public:
 			DataTableRowNameBPEditorCustomization()
@@ -148,15 +190,14 @@ namespace EasyDataTableRowName::Editor
 			bool ShouldKeyOptionsShow() const;
 			bool ShouldValueOptionsShow() const;
 			bool ShouldNameOptionsShow() const;
+			FOptionsVisibility ComputeOptionsVisibility() const;
+
+			FSoftObjectPath GetOptionsPath(ERowNameOptionsSlot Slot) const;
+			void SetOptionsPath(ERowNameOptionsSlot Slot, const FSoftObjectPath& Path);
 
 			void OnKeyPathChanged(const FSoftObjectPath& Path);
-			EVisibility KeyPathSelectorVisibility() const;
-		
 			void OnValuePathChanged(const FSoftObjectPath& Path);
-			EVisibility ValuePathSelectorVisibility() const;
-		
 			void OnCommonPathChanged(const FSoftObjectPath& Path);
-			EVisibility CommonPathSelectorVisibility() const;
 
 		public:
 			virtual void CustomizeDetails(IDetailLayoutBuilder& DetailBuilder) override;
@@ -181,6 +222,10 @@ namespace EasyDataTableRowName::Editor
 	
 			/** Cached name for the variable we are affecting */
 			FName CachedVariableName;
+
+			FOptionsVisibility CachedOptionsVisibility;
+			TWeakPtr<IPropertyUtilities> PropertyUtilities;
+			bool bRefreshBound = false;
 	
 			TWeakPtr<SMyBlueprint> MyBlueprint;
 	};
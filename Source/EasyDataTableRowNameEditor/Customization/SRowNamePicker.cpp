@@ -0,0 +1,144 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SRowNamePicker.h"
+
+#include "RowNameSource/RowNameUsageStats.h"
+#include "Settings/EasyDataTableRowNameSettings.h"
+#include "Widgets/Input/SSearchBox.h"
+
+EasyDataTableRowName::Editor::SRowNamePicker::~SRowNamePicker()
+{
+	FRowNameIndexCache::Get().RemoveMemoryReporter(this);
+}
+
+void EasyDataTableRowName::Editor::SRowNamePicker::Construct(const FArguments& InArgs)
+{
+	FRowNameIndexCache::Get().AddMemoryReporter(this);
+	RowNameSource = InArgs._RowNameSource;
+	OnRowNameSelected = InArgs._OnRowNameSelected;
+	RefreshItems();
+
+	ChildSlot
+	[
+		SNew(SBox)
+		.WidthOverride(280)
+		[
+			SNew(SVerticalBox)
+			.Visibility(EVisibility::SelfHitTestInvisible)
+			+ SVerticalBox::Slot()
+			.HAlign(EHorizontalAlignment::HAlign_Fill)
+			.VAlign(EVerticalAlignment::VAlign_Fill)
+			.AutoHeight()
+			.Padding(5.0)
+			[
+				SAssignNew(SearchBox, SSearchBox)
+				.OnTextChanged(this,&SRowNamePicker::OnSearchTextChanged)
+			]
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.MaxHeight(500)
+			[
+				SAssignNew(ListView,SListView<TSharedPtr<FName>>)
+				.Visibility(EVisibility::Visible)
+				.ListItemsSource(&FilteredItems)
+				.OnGenerateRow(this, &SRowNamePicker::OnGenerateRow)
+				.OnSelectionChanged(this, &SRowNamePicker::OnSelectionChanged)
+			]
+		]
+	];
+}
+
+TSharedPtr<SWidget> EasyDataTableRowName::Editor::SRowNamePicker::GetWidgetToFocus() const
+{
+	return SearchBox;
+}
+
+FString EasyDataTableRowName::Editor::SRowNamePicker::GetMemoryReportName() const
+{
+	return FString::Printf(TEXT("Picker %s"), *RowNameSource.SourcePath.ToString());
+}
+
+SIZE_T EasyDataTableRowName::Editor::SRowNamePicker::GetAllocatedSize() const
+{
+	return sizeof(SRowNamePicker) + FilteredItems.GetAllocatedSize() + SearchText.GetAllocatedSize();
+}
+
+void EasyDataTableRowName::Editor::SRowNamePicker::OnSearchTextChanged(const FText& Text)
+{
+	SearchText = Text.ToString();
+	RefreshItems();
+	if(ListView.IsValid())
+	{
+		ListView->RebuildList();
+	}
+}
+
+void EasyDataTableRowName::Editor::SRowNamePicker::OnSelectionChanged(TSharedPtr<FName> Item,
+	ESelectInfo::Type SelectInfo)
+{
+	if(Item.IsValid())
+	{
+		// Direct selections come from code and arrow keys only move through the list, neither is a pick
+		if(SelectInfo == ESelectInfo::OnMouseClick || SelectInfo == ESelectInfo::OnKeyPress)
+		{
+			FRowNameUsageStats::Get().RecordPick(RowNameSource.SourcePath, *Item.Get());
+		}
+		OnRowNameSelected.ExecuteIfBound(*Item.Get());
+	}
+}
+
+TSharedRef<ITableRow> EasyDataTableRowName::Editor::SRowNamePicker::OnGenerateRow(TSharedPtr<FName> Item,
+	const TSharedRef<STableViewBase>& OwnerTable)
+{
+	const FStringView DisplayString = RowNameIndex.IsValid() ? RowNameIndex->GetDisplayString(*Item.Get()) : FStringView();
+	if(DisplayString.IsEmpty())
+	{
+		return SNew(STableRow<TSharedPtr<FName>>, OwnerTable)
+		   [
+			  SNew(STextBlock)
+			  .Text(FText::FromName(*Item.Get()))
+		   ];
+	}
+
+	return SNew(STableRow<TSharedPtr<FName>>, OwnerTable)
+	   [
+		  SNew(SHorizontalBox)
+		  + SHorizontalBox::Slot()
+		  .AutoWidth()
+		  [
+			 SNew(STextBlock)
+			 .Text(FText::FromName(*Item.Get()))
+		  ]
+		  + SHorizontalBox::Slot()
+		  .FillWidth(1.0f)
+		  .Padding(8.0f, 0.0f, 0.0f, 0.0f)
+		  [
+			 SNew(STextBlock)
+			 .Text(FText::FromStringView(DisplayString))
+			 .ColorAndOpacity(FSlateColor::UseSubduedForeground())
+			 .OverflowPolicy(ETextOverflowPolicy::Ellipsis)
+		  ]
+	   ];
+}
+
+void EasyDataTableRowName::Editor::SRowNamePicker::RefreshItems()
+{
+	RowNameIndex = FRowNameIndexCache::Get().FindOrBuildIndex(RowNameSource);
+	const UEasyDataTableRowNameSettings* Settings = GetDefault<UEasyDataTableRowNameSettings>();
+	if(RowNameIndex.IsValid() && SearchText.IsEmpty() && Settings->bOrderRowsByUsage)
+	{
+		TArray<FName> PreferredRowNames;
+		FRowNameUsageStats::Get().GetPreferredRowNames(RowNameSource.SourcePath, Settings->UsageTopRowCount, PreferredRowNames);
+		RowNameIndex->OrderFirst(PreferredRowNames, FilteredItems);
+	}
+	else if(RowNameIndex.IsValid())
+	{
+		RowNameIndex->Filter(SearchText, FilteredItems);
+	}
+	else
+	{
+		FilteredItems.Reset();
+		FilteredItems.Add(MakeShared<FName>(NAME_None));
+	}
+}
@@ -0,0 +1,54 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "RowNameSource/RowNameIndexCache.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	DECLARE_DELEGATE_OneParam(FOnRowNameSelected, const FName&);
+
+	/**
+	 * Searchable row name list, the drop down content of every row name picker.
+	 * Only constructed when its menu opens, it reads the shared index of the source and
+	 * keeps nothing but the filtered item pointers.
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API SRowNamePicker : public SCompoundWidget, public IRowNameMemoryReporter
+	{
+		SLATE_BEGIN_ARGS(SRowNamePicker)
+			{}
+			SLATE_ARGUMENT(FRowNameSourceRef, RowNameSource)
+			SLATE_EVENT(FOnRowNameSelected, OnRowNameSelected)
+
+		SLATE_END_ARGS()
+
+		virtual ~SRowNamePicker() override;
+
+		void Construct(const FArguments& InArgs);
+
+		/** Keyboard focus target when the menu opens */
+		TSharedPtr<SWidget> GetWidgetToFocus() const;
+
+		virtual FString GetMemoryReportName() const override;
+		virtual SIZE_T GetAllocatedSize() const override;
+
+		protected:
+			void OnSearchTextChanged(const FText& Text);
+			void OnSelectionChanged(TSharedPtr<FName> Item, ESelectInfo::Type SelectInfo);
+			TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FName> Item, const TSharedRef<STableViewBase>& OwnerTable);
+			void RefreshItems();
+
+		protected:
+			FRowNameSourceRef RowNameSource;
+			FOnRowNameSelected OnRowNameSelected;
+
+			TSharedPtr<const FRowNameIndex> RowNameIndex;
+			FString SearchText;
+
+			/** Items currently listed, pointing into the shared RowNameIndex */
+			TArray<TSharedPtr<FName>> FilteredItems;
+			TSharedPtr<SListView<TSharedPtr<FName>>> ListView;
+			TSharedPtr<SWidget> SearchBox;
+	};
+}
@@ -35,7 +35,11 @@ public class EasyDataTableRowNameEditor : ModuleRules
                 "SlateCore",
                 "PropertyEditor",
                 "GraphEditor",
-                "InputCore"
+                "InputCore",
+                "ToolMenus",
+                "ContentBrowser",
+                "MainFrame",
+                "DeveloperSettings"
             }
         );
     }
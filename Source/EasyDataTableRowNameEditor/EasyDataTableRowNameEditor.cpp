@@ -1,9 +1,26 @@
 ﻿#include "EasyDataTableRowNameEditor.h"
 
+#include "Batch/RowNameOptionsBatchMenu.h"
+#include "Batch/RowNameSourceRenameHandler.h"
+#include "CodeGen/RowNameHeaderGeneratorMenu.h"
+#include "Graph/RowNameGraphPin.h"
+#include "RowNameSource/RowNameIndexPrewarmer.h"
+#include "RowNameSource/RowNameInheritance.h"
+#include "RowNameSource/RowNameSourceRedirects.h"
+#include "RowNameSource/RowNameUsageStats.h"
+
 #define LOCTEXT_NAMESPACE "FEasyDataTableRowNameEditorModule"
 
 void FEasyDataTableRowNameEditorModule::StartupModule()
 {
+	EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry& ProviderRegistry = EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::Get();
+	ProviderRegistry.RegisterProvider(MakeShared<EasyDataTableRowName::Editor::FDataTableRowNameSourceProvider>());
+	ProviderRegistry.RegisterProvider(MakeShared<EasyDataTableRowName::Editor::FCurveTableRowNameSourceProvider>());
+	ProviderRegistry.RegisterProvider(MakeShared<EasyDataTableRowName::Editor::FStringTableRowNameSourceProvider>());
+	EasyDataTableRowName::Editor::FRowNameIndexCache::Get().Startup();
+	EasyDataTableRowName::Editor::FRowNameUsageStats::Get().Startup();
+	EasyDataTableRowName::Editor::FRowNameInheritance::Get().Startup();
+
 	Identifier = MakeShared<EasyDataTableRowName::Editor::FDataTableRowNamePropertyTypeIdentifier>();
 
 	FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
@@ -16,6 +33,16 @@ void FEasyDataTableRowNameEditorModule::StartupModule()
 	FBlueprintEditorModule& BlueprintEditorModule = FModuleManager::LoadModuleChecked<FBlueprintEditorModule>("Kismet");
 	DataTableNameOptionsCustomizationHandle = BlueprintEditorModule.RegisterVariableCustomization(FProperty::StaticClass(), FOnGetVariableCustomizationInstance::CreateStatic(&EasyDataTableRowName::Editor::DataTableRowNameBPEditorCustomization::MakeInstance));
 
+	EasyDataTableRowName::Editor::FRowNameOptionsBatchMenu::Register();
+	EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::Register();
+	EasyDataTableRowName::Editor::FRowNameHeaderGeneratorMenu::Register();
+
+	RowNameGraphPinFactory = MakeShared<EasyDataTableRowName::Editor::FRowNameGraphPinFactory>();
+	FEdGraphUtilities::RegisterVisualPinFactory(RowNameGraphPinFactory);
+
+	Prewarmer = MakeUnique<EasyDataTableRowName::Editor::FRowNameIndexPrewarmer>();
+	Prewarmer->Startup();
+
 }
 
 void FEasyDataTableRowNameEditorModule::ShutdownModule()
@@ -25,6 +52,22 @@ void FEasyDataTableRowNameEditorModule::ShutdownModule()
 
 	FBlueprintEditorModule& BlueprintEditorModule = FModuleManager::LoadModuleChecked<FBlueprintEditorModule>("Kismet");
 	BlueprintEditorModule.UnregisterVariableCustomization(FProperty::StaticClass(), DataTableNameOptionsCustomizationHandle);
+
+	if(Prewarmer.IsValid())
+	{
+		Prewarmer->Shutdown();
+		Prewarmer.Reset();
+	}
+	EasyDataTableRowName::Editor::FRowNameHeaderGeneratorMenu::Unregister();
+	EasyDataTableRowName::Editor::FRowNameSourceRenameHandler::Unregister();
+	EasyDataTableRowName::Editor::FRowNameOptionsBatchMenu::Unregister();
+	FEdGraphUtilities::UnregisterVisualPinFactory(RowNameGraphPinFactory);
+	RowNameGraphPinFactory.Reset();
+	EasyDataTableRowName::Editor::FRowNameInheritance::Get().Shutdown();
+	EasyDataTableRowName::Editor::FRowNameUsageStats::Get().Shutdown();
+	EasyDataTableRowName::Editor::FRowNameIndexCache::Get().Shutdown();
+	EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::Get().Reset();
+	EasyDataTableRowName::Editor::FRowNameSourceRedirects::Get().Reset();
 }
 
 #undef LOCTEXT_NAMESPACE
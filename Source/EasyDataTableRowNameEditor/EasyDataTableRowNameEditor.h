@@ -4,6 +4,11 @@
 #include "Customization/DataTableRowNameCustomization.h"
 #include "Modules/ModuleManager.h"
 
+namespace EasyDataTableRowName::Editor
+{
+	class FRowNameIndexPrewarmer;
+}
+
 class FEasyDataTableRowNameEditorModule : public IModuleInterface
 {
 public:
@@ -14,4 +19,6 @@ protected:
 
     TSharedPtr<EasyDataTableRowName::Editor::FDataTableRowNamePropertyTypeIdentifier> Identifier;
     FDelegateHandle DataTableNameOptionsCustomizationHandle;
+    TSharedPtr<struct FGraphPanelPinFactory> RowNameGraphPinFactory;
+    TUniquePtr<EasyDataTableRowName::Editor::FRowNameIndexPrewarmer> Prewarmer;
 };
@@ -0,0 +1,109 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameGraphPin.h"
+
+#include "EdGraphSchema_K2.h"
+#include "K2Node_MakeStruct.h"
+#include "K2Node_VariableSet.h"
+#include "ScopedTransaction.h"
+#include "Customization/SRowNamePicker.h"
+#include "Widgets/Input/SComboButton.h"
+
+#define LOCTEXT_NAMESPACE "EasyDataTableRowName"
+
+TSharedPtr<SGraphPin> EasyDataTableRowName::Editor::FRowNameGraphPinFactory::CreatePin(UEdGraphPin* InPin) const
+{
+	// Called for every pin of every node widget, keep the rejection path to plain comparisons
+	if(InPin == nullptr
+		|| InPin->Direction != EGPD_Input
+		|| InPin->PinType.PinCategory != UEdGraphSchema_K2::PC_Name
+		|| InPin->PinType.IsContainer())
+	{
+		return nullptr;
+	}
+
+	const FRowNameSourceRef Source = ResolveRowNameSource(FindPinProperty(InPin));
+	if(!Source.IsValid())
+	{
+		return nullptr;
+	}
+	return SNew(SGraphPinRowName, InPin, Source);
+}
+
+const FProperty* EasyDataTableRowName::Editor::FRowNameGraphPinFactory::FindPinProperty(const UEdGraphPin* InPin)
+{
+	const UEdGraphNode* Node = InPin->GetOwningNode();
+	if(const UK2Node_VariableSet* SetNode = Cast<UK2Node_VariableSet>(Node))
+	{
+		if(InPin->PinName == SetNode->GetVarName())
+		{
+			return SetNode->GetPropertyForVariable();
+		}
+		return nullptr;
+	}
+
+	// Also covers Set Members, which derives from Make Struct
+	if(const UK2Node_MakeStruct* MakeNode = Cast<UK2Node_MakeStruct>(Node))
+	{
+		if(MakeNode->StructType != nullptr)
+		{
+			return MakeNode->StructType->FindPropertyByName(InPin->PinName);
+		}
+	}
+	return nullptr;
+}
+
+void EasyDataTableRowName::Editor::SGraphPinRowName::Construct(const FArguments& InArgs, UEdGraphPin* InGraphPinObj,
+	const FRowNameSourceRef& InRowNameSource)
+{
+	RowNameSource = InRowNameSource;
+	SGraphPin::Construct(SGraphPin::FArguments(), InGraphPinObj);
+}
+
+TSharedRef<SWidget> EasyDataTableRowName::Editor::SGraphPinRowName::GetDefaultValueWidget()
+{
+	return SAssignNew(ComboButton, SComboButton)
+		.OnGetMenuContent(this, &SGraphPinRowName::OnGetMenuContent)
+		.ContentPadding(FMargin(2.0f, 2.0f))
+		.Visibility(this, &SGraphPin::GetDefaultValueVisibility)
+		.IsEnabled(this, &SGraphPin::GetDefaultValueIsEditable)
+		.ButtonContent()
+		[
+			SNew(STextBlock)
+			.Text(this, &SGraphPinRowName::GetRowNameText)
+		];
+}
+
+FText EasyDataTableRowName::Editor::SGraphPinRowName::GetRowNameText() const
+{
+	return GraphPinObj != nullptr ? FText::FromString(GraphPinObj->GetDefaultAsString()) : FText::GetEmpty();
+}
+
+TSharedRef<SWidget> EasyDataTableRowName::Editor::SGraphPinRowName::OnGetMenuContent()
+{
+	TSharedRef<SRowNamePicker> Picker = SNew(SRowNamePicker)
+		.RowNameSource(RowNameSource)
+		.OnRowNameSelected(this, &SGraphPinRowName::OnRowNameSelected);
+	ComboButton->SetMenuContentWidgetToFocus(Picker->GetWidgetToFocus());
+	return Picker;
+}
+
+void EasyDataTableRowName::Editor::SGraphPinRowName::OnRowNameSelected(const FName& RowName)
+{
+	ComboButton->SetIsOpen(false);
+	if(GraphPinObj == nullptr || GraphPinObj->IsPendingKill())
+	{
+		return;
+	}
+
+	const FString NewValue = RowName.ToString();
+	if(GraphPinObj->GetDefaultAsString() != NewValue)
+	{
+		const FScopedTransaction Transaction(LOCTEXT("ChangeRowNamePinValue", "Change Row Name Pin Value"));
+		GraphPinObj->Modify();
+		GraphPinObj->GetSchema()->TrySetDefaultValue(*GraphPinObj, NewValue);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,47 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraphUtilities.h"
+#include "SGraphPin.h"
+#include "RowNameSource/RowNameSourceProvider.h"
+
+class SComboButton;
+
+namespace EasyDataTableRowName::Editor
+{
+	/**
+	 * Row name picker for FName input pins whose property carries OptionsFromXxx metadata:
+	 * Set variable nodes and Make / Set Members struct nodes.
+	 * Output pins (Get, Break) have no default value and keep the engine widget.
+	 */
+	class FRowNameGraphPinFactory : public FGraphPanelPinFactory
+	{
+		public:
+			virtual TSharedPtr<SGraphPin> CreatePin(UEdGraphPin* InPin) const override;
+
+			/** Property an FName pin edits, or nullptr when the node type is not supported */
+			static const FProperty* FindPinProperty(const UEdGraphPin* InPin);
+	};
+
+	/** Holds only the resolved source, the shared index is read when the drop down opens */
+	class SGraphPinRowName : public SGraphPin
+	{
+		public:
+			SLATE_BEGIN_ARGS(SGraphPinRowName)
+				{}
+			SLATE_END_ARGS()
+
+			void Construct(const FArguments& InArgs, UEdGraphPin* InGraphPinObj, const FRowNameSourceRef& InRowNameSource);
+
+		protected:
+			virtual TSharedRef<SWidget> GetDefaultValueWidget() override;
+
+			FText GetRowNameText() const;
+			TSharedRef<SWidget> OnGetMenuContent();
+			void OnRowNameSelected(const FName& RowName);
+
+		protected:
+			FRowNameSourceRef RowNameSource;
+			TSharedPtr<SComboButton> ComboButton;
+	};
+}
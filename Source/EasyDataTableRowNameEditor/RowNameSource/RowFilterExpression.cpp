@@ -0,0 +1,321 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowFilterExpression.h"
+
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+
+TSharedPtr<const EasyDataTableRowName::Editor::FRowFilterExpression> EasyDataTableRowName::Editor::FRowFilterExpression::
+Compile(const FString& Text, const UScriptStruct* RowStruct, FString& OutError)
+{
+	if(RowStruct == nullptr)
+	{
+		OutError = TEXT("the source has no row struct");
+		return nullptr;
+	}
+
+	TSharedRef<FRowFilterExpression> Expression = MakeShared<FRowFilterExpression>();
+	TArray<FString> OrParts;
+	SplitOutsideQuotes(Text, TEXT("||"), OrParts);
+	for (const FString& OrPart : OrParts)
+	{
+		TArray<FString> AndParts;
+		SplitOutsideQuotes(OrPart, TEXT("&&"), AndParts);
+		TArray<FTerm>& Clause = Expression->Clauses.AddDefaulted_GetRef();
+		for (const FString& AndPart : AndParts)
+		{
+			if(!CompileTerm(AndPart.TrimStartAndEnd(), RowStruct, Clause.AddDefaulted_GetRef(), OutError))
+			{
+				return nullptr;
+			}
+		}
+		if(Clause.IsEmpty())
+		{
+			OutError = FString::Printf(TEXT("empty clause in \"%s\""), *Text);
+			return nullptr;
+		}
+	}
+
+	if(Expression->Clauses.IsEmpty())
+	{
+		OutError = TEXT("empty expression");
+		return nullptr;
+	}
+	return Expression;
+}
+
+bool EasyDataTableRowName::Editor::FRowFilterExpression::Evaluate(const uint8* RowData) const
+{
+	for (const TArray<FTerm>& Clause : Clauses)
+	{
+		bool bClauseMatches = true;
+		for (const FTerm& Term : Clause)
+		{
+			if(!EvaluateTerm(Term, RowData))
+			{
+				bClauseMatches = false;
+				break;
+			}
+		}
+		if(bClauseMatches)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void EasyDataTableRowName::Editor::FRowFilterExpression::SplitOutsideQuotes(const FString& Text, const TCHAR* Separator,
+	TArray<FString>& OutParts)
+{
+	const int32 SeparatorLength = FCString::Strlen(Separator);
+	TCHAR Quote = 0;
+	int32 PartStart = 0;
+	auto AddPart = [&Text, &OutParts](int32 Start, int32 End)
+	{
+		FString Part = Text.Mid(Start, End - Start);
+		if(!Part.TrimStartAndEnd().IsEmpty())
+		{
+			OutParts.Add(MoveTemp(Part));
+		}
+	};
+	for (int32 CharIndex = 0; CharIndex < Text.Len(); ++CharIndex)
+	{
+		const TCHAR Char = Text[CharIndex];
+		if(Quote != 0)
+		{
+			Quote = Char == Quote ? 0 : Quote;
+		}
+		else if(Char == TEXT('"') || Char == TEXT('\''))
+		{
+			Quote = Char;
+		}
+		else if(FCString::Strncmp(*Text + CharIndex, Separator, SeparatorLength) == 0)
+		{
+			AddPart(PartStart, CharIndex);
+			PartStart = CharIndex + SeparatorLength;
+			CharIndex += SeparatorLength - 1;
+		}
+	}
+	AddPart(PartStart, Text.Len());
+}
+
+bool EasyDataTableRowName::Editor::FRowFilterExpression::CompileTerm(const FString& TermText,
+	const UScriptStruct* RowStruct, FTerm& OutTerm, FString& OutError)
+{
+	static const TPair<const TCHAR*, EOperator> Operators[] =
+	{
+		{TEXT(">="), EOperator::GreaterEqual},
+		{TEXT("<="), EOperator::LessEqual},
+		{TEXT("=="), EOperator::Equal},
+		{TEXT("!="), EOperator::NotEqual},
+		{TEXT(">"), EOperator::Greater},
+		{TEXT("<"), EOperator::Less},
+	};
+
+	int32 OperatorIndex = INDEX_NONE;
+	int32 OperatorLength = 0;
+	for (int32 CharIndex = 0; CharIndex < TermText.Len() && OperatorIndex == INDEX_NONE; ++CharIndex)
+	{
+		for (const TPair<const TCHAR*, EOperator>& Operator : Operators)
+		{
+			const int32 Length = FCString::Strlen(Operator.Key);
+			if(FCString::Strncmp(*TermText + CharIndex, Operator.Key, Length) == 0)
+			{
+				OperatorIndex = CharIndex;
+				OperatorLength = Length;
+				OutTerm.Operator = Operator.Value;
+				break;
+			}
+		}
+	}
+	if(OperatorIndex == INDEX_NONE)
+	{
+		OutError = FString::Printf(TEXT("no comparison operator in \"%s\""), *TermText);
+		return false;
+	}
+
+	const FString FieldName = TermText.Left(OperatorIndex).TrimStartAndEnd();
+	FString Value = TermText.Mid(OperatorIndex + OperatorLength).TrimStartAndEnd();
+	// Either quote may protect && and || inside a value, see SplitOutsideQuotes
+	if(Value.Len() >= 2 && (Value[0] == TEXT('"') || Value[0] == TEXT('\'')) && Value[Value.Len() - 1] == Value[0])
+	{
+		Value.MidInline(1, Value.Len() - 2);
+	}
+
+	OutTerm.Property = FindField(RowStruct, FieldName);
+	if(OutTerm.Property == nullptr)
+	{
+		OutError = FString::Printf(TEXT("%s has no field \"%s\""), *RowStruct->GetName(), *FieldName);
+		return false;
+	}
+
+	const bool bIsEquality = OutTerm.Operator == EOperator::Equal || OutTerm.Operator == EOperator::NotEqual;
+	const FProperty* Property = OutTerm.Property;
+	const UEnum* Enum = nullptr;
+	if(const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		Enum = EnumProperty->GetEnum();
+	}
+	else if(const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+	{
+		Enum = ByteProperty->Enum;
+	}
+
+	if(CastField<FBoolProperty>(Property))
+	{
+		if(!bIsEquality)
+		{
+			OutError = FString::Printf(TEXT("\"%s\" is a bool, only == and != apply"), *FieldName);
+			return false;
+		}
+		OutTerm.Kind = EValueKind::Bool;
+		// FString::ToBool reads every other word as false, a typo would silently hide every row
+		if(Value.Equals(TEXT("true"), ESearchCase::IgnoreCase))
+		{
+			OutTerm.bBool = true;
+		}
+		else if(Value.Equals(TEXT("false"), ESearchCase::IgnoreCase))
+		{
+			OutTerm.bBool = false;
+		}
+		else
+		{
+			OutError = FString::Printf(TEXT("\"%s\" is not true or false"), *Value);
+			return false;
+		}
+	}
+	else if(Enum != nullptr)
+	{
+		OutTerm.Kind = EValueKind::Number;
+		int64 EnumValue = Enum->GetValueByNameString(Value, EGetByNameFlags::CheckAuthoredName);
+		for (int32 EnumIndex = 0; EnumValue == INDEX_NONE && EnumIndex < Enum->NumEnums(); ++EnumIndex)
+		{
+			if(Enum->GetDisplayNameTextByIndex(EnumIndex).ToString().Equals(Value, ESearchCase::IgnoreCase))
+			{
+				EnumValue = Enum->GetValueByIndex(EnumIndex);
+			}
+		}
+		if(EnumValue == INDEX_NONE && !LexTryParseString(OutTerm.Number, *Value))
+		{
+			OutError = FString::Printf(TEXT("%s has no entry \"%s\""), *Enum->GetName(), *Value);
+			return false;
+		}
+		if(EnumValue != INDEX_NONE)
+		{
+			OutTerm.Number = static_cast<double>(EnumValue);
+		}
+	}
+	else if(CastField<FNumericProperty>(Property))
+	{
+		OutTerm.Kind = EValueKind::Number;
+		if(!LexTryParseString(OutTerm.Number, *Value))
+		{
+			OutError = FString::Printf(TEXT("\"%s\" is not a number"), *Value);
+			return false;
+		}
+	}
+	else if(CastField<FNameProperty>(Property))
+	{
+		if(!bIsEquality)
+		{
+			OutError = FString::Printf(TEXT("\"%s\" is a name, only == and != apply"), *FieldName);
+			return false;
+		}
+		OutTerm.Kind = EValueKind::Name;
+		OutTerm.Name = FName(*Value);
+	}
+	else if(CastField<FStrProperty>(Property) || CastField<FTextProperty>(Property))
+	{
+		OutTerm.Kind = EValueKind::String;
+		OutTerm.String = Value;
+	}
+	else
+	{
+		OutError = FString::Printf(TEXT("field \"%s\" of type %s cannot be filtered"), *FieldName, *Property->GetCPPType());
+		return false;
+	}
+	return true;
+}
+
+const FProperty* EasyDataTableRowName::Editor::FRowFilterExpression::FindField(const UScriptStruct* RowStruct,
+	const FString& FieldName)
+{
+	if(const FProperty* Property = RowStruct->FindPropertyByName(*FieldName))
+	{
+		return Property;
+	}
+	// User defined structs store GUID suffixed names, match what the designer typed
+	for (TFieldIterator<FProperty> It(RowStruct); It; ++It)
+	{
+		if(It->GetAuthoredName().Equals(FieldName, ESearchCase::IgnoreCase))
+		{
+			return *It;
+		}
+	}
+	return nullptr;
+}
+
+bool EasyDataTableRowName::Editor::FRowFilterExpression::EvaluateTerm(const FTerm& Term, const uint8* RowData)
+{
+	const void* ValuePtr = Term.Property->ContainerPtrToValuePtr<void>(RowData);
+	switch (Term.Kind)
+	{
+	case EValueKind::Bool:
+		{
+			const bool bValue = CastFieldChecked<const FBoolProperty>(Term.Property)->GetPropertyValue(ValuePtr);
+			return Compare(bValue, Term.bBool, Term.Operator);
+		}
+	case EValueKind::Number:
+		{
+			double Number = 0.0;
+			if(const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Term.Property))
+			{
+				Number = static_cast<double>(EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr));
+			}
+			else
+			{
+				const FNumericProperty* NumericProperty = CastFieldChecked<const FNumericProperty>(Term.Property);
+				Number = NumericProperty->IsFloatingPoint()
+					? NumericProperty->GetFloatingPointPropertyValue(ValuePtr)
+					: static_cast<double>(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+			}
+			return Compare(Number, Term.Number, Term.Operator);
+		}
+	case EValueKind::Name:
+		{
+			const FName& Name = *static_cast<const FName*>(ValuePtr);
+			return Term.Operator == EOperator::Equal ? Name == Term.Name : Name != Term.Name;
+		}
+	case EValueKind::String:
+		{
+			const FString& String = CastField<FTextProperty>(Term.Property)
+				? static_cast<const FText*>(ValuePtr)->ToString()
+				: *static_cast<const FString*>(ValuePtr);
+			return Compare(String.Compare(Term.String, ESearchCase::IgnoreCase), 0, Term.Operator);
+		}
+	}
+	return false;
+}
+
+template<typename T>
+bool EasyDataTableRowName::Editor::FRowFilterExpression::Compare(const T& Left, const T& Right, EOperator Operator)
+{
+	switch (Operator)
+	{
+	case EOperator::Equal:
+		return Left == Right;
+	case EOperator::NotEqual:
+		return Left != Right;
+	case EOperator::Greater:
+		return Left > Right;
+	case EOperator::GreaterEqual:
+		return Left >= Right;
+	case EOperator::Less:
+		return Left < Right;
+	case EOperator::LessEqual:
+		return Left <= Right;
+	}
+	return false;
+}
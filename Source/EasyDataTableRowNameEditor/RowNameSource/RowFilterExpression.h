@@ -0,0 +1,66 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	/**
+	 * RowFilter metadata compiled against a row struct, e.g. "Category==Weapon && Tier>=2".
+	 * Terms are "Field Op Value" with Op one of == != > >= < <=, joined by && (binding tighter) and ||.
+	 * Fields may be numeric, bool (true / false), enum (by entry name), FName, FString or FText members of the
+	 * struct; values containing && or || must be quoted, "Title==\"A && B\"".
+	 * Every field is looked up once on compile, evaluation only reads memory.
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API FRowFilterExpression
+	{
+		public:
+			/** Returns nullptr and fills OutError when Text does not parse or names unknown fields */
+			static TSharedPtr<const FRowFilterExpression> Compile(const FString& Text, const UScriptStruct* RowStruct, FString& OutError);
+
+			bool Evaluate(const uint8* RowData) const;
+
+			/** Finds a member of RowStruct by name, or by the name typed in the editor for user defined structs */
+			static const FProperty* FindField(const UScriptStruct* RowStruct, const FString& FieldName);
+
+		private:
+			enum class EOperator : uint8
+			{
+				Equal,
+				NotEqual,
+				Greater,
+				GreaterEqual,
+				Less,
+				LessEqual,
+			};
+
+			enum class EValueKind : uint8
+			{
+				Number,
+				Bool,
+				Name,
+				String,
+			};
+
+			struct FTerm
+			{
+				const FProperty* Property = nullptr;
+				EOperator Operator = EOperator::Equal;
+				EValueKind Kind = EValueKind::Number;
+				double Number = 0.0;
+				bool bBool = false;
+				FName Name;
+				FString String;
+			};
+
+			/** Splits Text at Separator outside of '...' and "..." quotes, empty parts are dropped */
+			static void SplitOutsideQuotes(const FString& Text, const TCHAR* Separator, TArray<FString>& OutParts);
+			static bool CompileTerm(const FString& TermText, const UScriptStruct* RowStruct, FTerm& OutTerm, FString& OutError);
+			static bool EvaluateTerm(const FTerm& Term, const uint8* RowData);
+
+			template<typename T>
+			static bool Compare(const T& Left, const T& Right, EOperator Operator);
+
+			/** Disjunction of conjunctions */
+			TArray<TArray<FTerm>> Clauses;
+	};
+}
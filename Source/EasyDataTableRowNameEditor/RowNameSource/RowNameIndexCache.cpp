@@ -0,0 +1,696 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameIndexCache.h"
+
+#include "Algo/LevenshteinDistance.h"
+#include "Editor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/TransactionObjectEvent.h"
+#include "Settings/EasyDataTableRowNameSettings.h"
+#include "UObject/ObjectRedirector.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UObjectGlobals.h"
+
+EasyDataTableRowName::Editor::FRowNameIndex::FRowNameIndex(const TArray<FName>& InRowNames, uint32 InVersion,
+	const TArray<FString>& InDisplayStrings)
+	: Version(InVersion)
+{
+	check(InDisplayStrings.IsEmpty() || InDisplayStrings.Num() == InRowNames.Num());
+	Items.Reserve(InRowNames.Num() + 1);
+	SearchKeys.Reserve(InRowNames.Num() + 1);
+	RowIndices.Reserve(InRowNames.Num());
+
+	Items.Add(MakeShared<FName>(NAME_None));
+	SearchKeys.Add(FName(NAME_None).ToString().ToLower());
+	for (const FName& RowName : InRowNames)
+	{
+		RowIndices.Add(RowName, Items.Num());
+		Items.Add(MakeShared<FName>(RowName));
+		SearchKeys.Add(RowName.ToString().ToLower());
+	}
+
+	if(!InDisplayStrings.IsEmpty())
+	{
+		int32 BufferLength = 0;
+		for (const FString& DisplayString : InDisplayStrings)
+		{
+			BufferLength += DisplayString.Len();
+		}
+		DisplayBuffer.Reserve(BufferLength);
+		DisplayOffsets.Reserve(Items.Num() + 1);
+
+		// NAME_None has no row, hence no display string
+		DisplayOffsets.Add(0);
+		DisplayOffsets.Add(0);
+		for (int32 Index = 0; Index < InDisplayStrings.Num(); ++Index)
+		{
+			const FString& DisplayString = InDisplayStrings[Index];
+			DisplayBuffer.Append(DisplayString);
+			DisplayOffsets.Add(DisplayBuffer.Len());
+			if(!DisplayString.IsEmpty())
+			{
+				FString& SearchKey = SearchKeys[Index + 1];
+				SearchKey.AppendChar(TEXT('\n'));
+				SearchKey.Append(DisplayString.ToLower());
+			}
+		}
+	}
+
+	// Every item is its own MakeShared block: reference controller plus the FName
+	AllocatedSize = sizeof(FRowNameIndex) + Items.GetAllocatedSize() + SearchKeys.GetAllocatedSize()
+		+ RowIndices.GetAllocatedSize() + DisplayBuffer.GetAllocatedSize() + DisplayOffsets.GetAllocatedSize()
+		+ Items.Num() * (sizeof(void*) + 2 * sizeof(int32) + sizeof(FName));
+	for (const FString& SearchKey : SearchKeys)
+	{
+		AllocatedSize += SearchKey.GetAllocatedSize();
+	}
+}
+
+bool EasyDataTableRowName::Editor::FRowNameIndex::Contains(const FName& RowName) const
+{
+	return RowName.IsNone() || RowIndices.Contains(RowName);
+}
+
+FStringView EasyDataTableRowName::Editor::FRowNameIndex::GetDisplayString(const FName& RowName) const
+{
+	const int32* Index = RowIndices.Find(RowName);
+	if(Index == nullptr || DisplayOffsets.IsEmpty())
+	{
+		return FStringView();
+	}
+	const int32 Start = DisplayOffsets[*Index];
+	return FStringView(*DisplayBuffer + Start, DisplayOffsets[*Index + 1] - Start);
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndex::Filter(const FString& SearchText,
+	TArray<TSharedPtr<FName>>& OutItems) const
+{
+	OutItems.Reset();
+	if(SearchText.IsEmpty())
+	{
+		OutItems = Items;
+		return;
+	}
+
+	const FString LowerSearchText = SearchText.ToLower();
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		if(SearchKeys[Index].Contains(LowerSearchText, ESearchCase::CaseSensitive))
+		{
+			OutItems.Add(Items[Index]);
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndex::OrderFirst(const TArray<FName>& PreferredRowNames,
+	TArray<TSharedPtr<FName>>& OutItems) const
+{
+	OutItems.Reset(Items.Num());
+	TBitArray<> bListed(false, Items.Num());
+	OutItems.Add(Items[0]);
+	bListed[0] = true;
+	for (const FName& RowName : PreferredRowNames)
+	{
+		const int32* Index = RowIndices.Find(RowName);
+		if(Index != nullptr && !bListed[*Index])
+		{
+			OutItems.Add(Items[*Index]);
+			bListed[*Index] = true;
+		}
+	}
+	for (int32 Index = 1; Index < Items.Num(); ++Index)
+	{
+		if(!bListed[Index])
+		{
+			OutItems.Add(Items[Index]);
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndex::FindSimilar(const FString& Text, int32 MaxDistance, int32 MaxResults,
+	TArray<FName>& OutRowNames) const
+{
+	OutRowNames.Reset();
+	const FString LowerText = Text.ToLower();
+	TArray<TPair<int32, int32>> Candidates;
+	// Item 0 is NAME_None, never a suggestion
+	for (int32 Index = 1; Index < Items.Num(); ++Index)
+	{
+		FStringView NameKey(SearchKeys[Index]);
+		int32 DisplayStart = INDEX_NONE;
+		if(NameKey.FindChar(TEXT('\n'), DisplayStart))
+		{
+			NameKey.LeftInline(DisplayStart);
+		}
+		// The distance is at least the length difference, skip the full computation
+		if(FMath::Abs(NameKey.Len() - LowerText.Len()) > MaxDistance)
+		{
+			continue;
+		}
+		const int32 Distance = Algo::LevenshteinDistance(NameKey, LowerText);
+		if(Distance <= MaxDistance)
+		{
+			Candidates.Emplace(Distance, Index);
+		}
+	}
+
+	Candidates.StableSort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+	const int32 NumResults = MaxResults > 0 ? FMath::Min(MaxResults, Candidates.Num()) : Candidates.Num();
+	OutRowNames.Reserve(NumResults);
+	for (int32 Index = 0; Index < NumResults; ++Index)
+	{
+		OutRowNames.Add(*Items[Candidates[Index].Value]);
+	}
+}
+
+EasyDataTableRowName::Editor::FRowNameIndexCache& EasyDataTableRowName::Editor::FRowNameIndexCache::Get()
+{
+	static FRowNameIndexCache Cache;
+	return Cache;
+}
+
+TSharedPtr<const EasyDataTableRowName::Editor::FRowNameIndex> EasyDataTableRowName::Editor::FRowNameIndexCache::
+FindOrBuildIndex(const FRowNameSourceRef& Source)
+{
+	check(IsInGameThread());
+	if(!Source.IsValid())
+	{
+		return nullptr;
+	}
+
+	UObject* SourceObject = nullptr;
+	FEntry* Entry = BindEntry(Source, SourceObject);
+	if(Entry == nullptr)
+	{
+		return nullptr;
+	}
+	Entry->LastAccess = ++AccessClock;
+
+	if(Entry->bDirty || !Entry->Index.IsValid())
+	{
+		TArray<FName> RowNames;
+		Entry->Provider->GetRowNames(SourceObject, RowNames);
+		Entry->Index = MakeShared<const FRowNameIndex>(RowNames, ++Entry->Version);
+		Entry->bDirty = false;
+		PublishToSlot(Source.SourcePath, Entry->Index);
+	}
+
+	TSharedPtr<const FRowNameIndex> Index = Source.RowFilter.IsEmpty() && Source.DisplayField.IsEmpty()
+		? Entry->Index
+		: FindOrBuildDerivedIndex(*Entry, SourceObject, Source);
+	UpdateAllocatedSize(*Entry);
+	TrimToBudget(Source.SourcePath);
+	return Index;
+}
+
+TSharedPtr<const EasyDataTableRowName::Editor::FRowNameIndex> EasyDataTableRowName::Editor::FRowNameIndexCache::
+FindOrBuildDerivedIndex(FEntry& Entry, const UObject* SourceObject, const FRowNameSourceRef& Source)
+{
+	FDerivedIndex& Derived = Entry.DerivedIndexes.FindOrAdd(TPair<FString, FString>(Source.RowFilter, Source.DisplayField));
+	if(Derived.Index.IsValid() && Derived.BaseVersion == Entry.Version)
+	{
+		return Derived.Index;
+	}
+
+	const UScriptStruct* RowStruct = Entry.Provider->GetRowStruct(SourceObject);
+	const TSharedPtr<const FRowFilterExpression> Expression = Source.RowFilter.IsEmpty()
+		? nullptr
+		: FindOrCompileFilter(RowStruct, Source.RowFilter);
+	const FProperty* DisplayProperty = Source.DisplayField.IsEmpty()
+		? nullptr
+		: FindDisplayProperty(RowStruct, Source.DisplayField);
+
+	if(Expression.IsValid() || DisplayProperty != nullptr)
+	{
+		TArray<FName> RowNames;
+		TArray<FString> DisplayStrings;
+		Entry.Provider->ForEachRow(SourceObject, [&](const FName& RowName, const uint8* RowData)
+		{
+			if(Expression.IsValid() && !Expression->Evaluate(RowData))
+			{
+				return;
+			}
+			RowNames.Add(RowName);
+			if(DisplayProperty != nullptr)
+			{
+				DisplayStrings.Add(ExtractDisplayString(DisplayProperty, RowData));
+			}
+		});
+		Derived.Index = MakeShared<const FRowNameIndex>(RowNames, Entry.Version, DisplayStrings);
+	}
+	else
+	{
+		// A broken filter or field must not hide the table, fall back to every row
+		Derived.Index = Entry.Index;
+	}
+	Derived.BaseVersion = Entry.Version;
+	return Derived.Index;
+}
+
+TSharedPtr<const EasyDataTableRowName::Editor::FRowFilterExpression> EasyDataTableRowName::Editor::FRowNameIndexCache::
+FindOrCompileFilter(const UScriptStruct* RowStruct, const FString& RowFilter)
+{
+	const TPair<const UScriptStruct*, FString> Key(RowStruct, RowFilter);
+	if(const TSharedPtr<const FRowFilterExpression>* Compiled = CompiledFilters.Find(Key))
+	{
+		return *Compiled;
+	}
+
+	FString Error;
+	TSharedPtr<const FRowFilterExpression> Expression = FRowFilterExpression::Compile(RowFilter, RowStruct, Error);
+	if(!Expression.IsValid())
+	{
+		UE_LOG(LogEasyDataTableRowName, Warning, TEXT("RowFilter \"%s\" ignored: %s"), *RowFilter, *Error);
+	}
+	CompiledFilters.Add(Key, Expression);
+	return Expression;
+}
+
+const FProperty* EasyDataTableRowName::Editor::FRowNameIndexCache::FindDisplayProperty(const UScriptStruct* RowStruct,
+	const FString& DisplayField)
+{
+	const TPair<const UScriptStruct*, FString> Key(RowStruct, DisplayField);
+	if(const FProperty* const* Found = DisplayProperties.Find(Key))
+	{
+		return *Found;
+	}
+
+	const FProperty* DisplayProperty = RowStruct != nullptr ? FRowFilterExpression::FindField(RowStruct, DisplayField) : nullptr;
+	if(DisplayProperty == nullptr)
+	{
+		UE_LOG(LogEasyDataTableRowName, Warning, TEXT("RowDisplayField \"%s\" ignored: %s has no such field"),
+			*DisplayField, RowStruct != nullptr ? *RowStruct->GetName() : TEXT("the source"));
+	}
+	DisplayProperties.Add(Key, DisplayProperty);
+	return DisplayProperty;
+}
+
+FString EasyDataTableRowName::Editor::FRowNameIndexCache::ExtractDisplayString(const FProperty* DisplayProperty,
+	const uint8* RowData)
+{
+	const void* ValuePtr = DisplayProperty->ContainerPtrToValuePtr<void>(RowData);
+	if(const FTextProperty* TextProperty = CastField<FTextProperty>(DisplayProperty))
+	{
+		return TextProperty->GetPropertyValue(ValuePtr).ToString();
+	}
+	if(const FStrProperty* StrProperty = CastField<FStrProperty>(DisplayProperty))
+	{
+		return StrProperty->GetPropertyValue(ValuePtr);
+	}
+	if(const FNameProperty* NameProperty = CastField<FNameProperty>(DisplayProperty))
+	{
+		return NameProperty->GetPropertyValue(ValuePtr).ToString();
+	}
+	FString DisplayString;
+	DisplayProperty->ExportTextItem_Direct(DisplayString, ValuePtr, nullptr, nullptr, PPF_None);
+	return DisplayString;
+}
+
+bool EasyDataTableRowName::Editor::FRowNameIndexCache::PrepareBuildTicket(const FRowNameSourceRef& Source,
+	FRowNameIndexBuildTicket& OutTicket)
+{
+	check(IsInGameThread());
+	UObject* SourceObject = nullptr;
+	FEntry* Entry = BindEntry(Source, SourceObject);
+	if(Entry == nullptr || (!Entry->bDirty && Entry->Index.IsValid()))
+	{
+		return false;
+	}
+
+	OutTicket.SourcePath = Source.SourcePath;
+	OutTicket.RowNames.Reset();
+	Entry->Provider->GetRowNames(SourceObject, OutTicket.RowNames);
+	OutTicket.ChangeSerial = Entry->ChangeSerial;
+	OutTicket.Version = Entry->Version + 1;
+	return true;
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::PublishIndex(const FRowNameIndexBuildTicket& Ticket,
+	const TSharedRef<const FRowNameIndex>& Index)
+{
+	check(IsInGameThread());
+	FEntry* Entry = Entries.Find(Ticket.SourcePath);
+	if(Entry == nullptr || Entry->ChangeSerial != Ticket.ChangeSerial || (!Entry->bDirty && Entry->Index.IsValid()))
+	{
+		return;
+	}
+	Entry->Index = Index;
+	Entry->Version = Ticket.Version;
+	Entry->bDirty = false;
+	PublishToSlot(Ticket.SourcePath, Index);
+	UpdateAllocatedSize(*Entry);
+	TrimToBudget(FSoftObjectPath());
+}
+
+EasyDataTableRowName::Editor::FRowNameIndexCache::FEntry* EasyDataTableRowName::Editor::FRowNameIndexCache::BindEntry(
+	const FRowNameSourceRef& Source, UObject*& OutSourceObject)
+{
+	OutSourceObject = ResolveSourceObject(Source);
+	if(!IsValid(OutSourceObject))
+	{
+		return nullptr;
+	}
+
+	FEntry& Entry = Entries.FindOrAdd(Source.SourcePath);
+	if(Entry.SourceObject.Get() != OutSourceObject || Entry.Provider != Source.Provider)
+	{
+		ReleaseEntry(Source.SourcePath, Entry);
+		Entry.Provider = Source.Provider;
+		Entry.SourceObject = OutSourceObject;
+		Entry.SourceChangedHandle = Source.Provider->BindSourceChanged(OutSourceObject,
+			FSimpleDelegate::CreateRaw(this, &FRowNameIndexCache::OnSourceChanged, Source.SourcePath));
+		Entry.bDirty = true;
+		++Entry.ChangeSerial;
+	}
+	return &Entry;
+}
+
+UObject* EasyDataTableRowName::Editor::FRowNameIndexCache::ResolveSourceObject(const FRowNameSourceRef& Source) const
+{
+	if(!Source.IsValid())
+	{
+		return nullptr;
+	}
+	UObject* SourceObject = FindObject<UObject>(nullptr, *Source.SourcePath.ToString());
+	if(const UObjectRedirector* Redirector = Cast<UObjectRedirector>(SourceObject))
+	{
+		SourceObject = Redirector->DestinationObject;
+	}
+	if(SourceObject == nullptr || !SourceObject->IsA(Source.Provider->GetSourceClass()))
+	{
+		return nullptr;
+	}
+	return SourceObject;
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::Invalidate(const FSoftObjectPath& SourcePath)
+{
+	if(FEntry* Entry = Entries.Find(SourcePath))
+	{
+		Entry->bDirty = true;
+		++Entry->ChangeSerial;
+		// The row struct may have been edited with the table, field lookups are redone
+		CompiledFilters.Reset();
+		DisplayProperties.Reset();
+
+		// Nobody on the game thread may ask again soon, keep what other threads read current
+		const TSharedRef<FRowNameIndexSlot>* Slot = Slots.Find(SourcePath);
+		if(Slot != nullptr && !Slot->IsUnique())
+		{
+			SlotsToRefresh.Add(SourcePath);
+			ScheduleSlotTick();
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::PinSource(const FSoftObjectPath& SourcePath)
+{
+	FEntry* Entry = Entries.Find(SourcePath);
+	if(Entry != nullptr && !Entry->PinnedSource.IsValid())
+	{
+		if(UObject* SourceObject = Entry->SourceObject.Get())
+		{
+			Entry->PinnedSource.Reset(SourceObject);
+		}
+	}
+}
+
+TSharedRef<const EasyDataTableRowName::Editor::FRowNameIndexSlot> EasyDataTableRowName::Editor::FRowNameIndexCache::
+AcquireSlot(const FRowNameSourceRef& Source)
+{
+	check(IsInGameThread());
+	const TSharedRef<FRowNameIndexSlot>* ExistingSlot = Slots.Find(Source.SourcePath);
+	const TSharedRef<const FRowNameIndexSlot> Slot = ExistingSlot != nullptr
+		? *ExistingSlot
+		: Slots.Add(Source.SourcePath, MakeShared<FRowNameIndexSlot>());
+
+	FRowNameSourceRef FullSource;
+	FullSource.Provider = Source.Provider;
+	FullSource.SourcePath = Source.SourcePath;
+	if(const TSharedPtr<const FRowNameIndex> Index = FindOrBuildIndex(FullSource))
+	{
+		// Built before the slot existed, or by an earlier call
+		PublishToSlot(Source.SourcePath, Index);
+	}
+	return Slot;
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::PublishToSlot(const FSoftObjectPath& SourcePath,
+	const TSharedPtr<const FRowNameIndex>& Index)
+{
+	const TSharedRef<FRowNameIndexSlot>* Slot = Slots.Find(SourcePath);
+	if(Slot == nullptr || (*Slot)->Read() == Index)
+	{
+		return;
+	}
+	(*Slot)->Publish(Index);
+	if((*Slot)->HasRetired())
+	{
+		SlotsToCollect.Add(SourcePath);
+		ScheduleSlotTick();
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::ScheduleSlotTick()
+{
+	if(!SlotTickHandle.IsValid())
+	{
+		SlotTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FRowNameIndexCache::TickSlots));
+	}
+}
+
+bool EasyDataTableRowName::Editor::FRowNameIndexCache::TickSlots(float DeltaTime)
+{
+	for (const FSoftObjectPath& SourcePath : SlotsToRefresh)
+	{
+		if(const FEntry* Entry = Entries.Find(SourcePath))
+		{
+			FRowNameSourceRef Source;
+			Source.Provider = Entry->Provider;
+			Source.SourcePath = SourcePath;
+			FindOrBuildIndex(Source);
+		}
+	}
+	SlotsToRefresh.Reset();
+
+	for (auto It = SlotsToCollect.CreateIterator(); It; ++It)
+	{
+		const TSharedRef<FRowNameIndexSlot>* Slot = Slots.Find(*It);
+		if(Slot != nullptr)
+		{
+			(*Slot)->CollectRetired();
+		}
+		if(Slot == nullptr || !(*Slot)->HasRetired())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if(SlotsToCollect.IsEmpty())
+	{
+		SlotTickHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::AddMemoryReporter(const IRowNameMemoryReporter* Reporter)
+{
+	MemoryReporters.AddUnique(Reporter);
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::RemoveMemoryReporter(const IRowNameMemoryReporter* Reporter)
+{
+	MemoryReporters.RemoveSingleSwap(Reporter);
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::DumpMemory(FOutputDevice& Ar) const
+{
+	const int32 BudgetMB = GetDefault<UEasyDataTableRowNameSettings>()->RowNameCacheBudgetMB;
+	Ar.Logf(TEXT("Row name indexes: %.2f MB in %d tables, budget %s"), TotalAllocatedSize / (1024.0 * 1024.0), Entries.Num(),
+		BudgetMB > 0 ? *FString::Printf(TEXT("%d MB"), BudgetMB) : TEXT("unlimited"));
+
+	TArray<const TPair<FSoftObjectPath, FEntry>*> SortedEntries;
+	for (const TPair<FSoftObjectPath, FEntry>& Pair : Entries)
+	{
+		SortedEntries.Add(&Pair);
+	}
+	SortedEntries.Sort([](const TPair<FSoftObjectPath, FEntry>& A, const TPair<FSoftObjectPath, FEntry>& B)
+	{
+		return A.Value.AllocatedSize > B.Value.AllocatedSize;
+	});
+	for (const TPair<FSoftObjectPath, FEntry>* Pair : SortedEntries)
+	{
+		const FEntry& Entry = Pair->Value;
+		Ar.Logf(TEXT("  %10.1f KB  %7d rows  v%-4u %d derived%s  %s"), Entry.AllocatedSize / 1024.0,
+			Entry.Index.IsValid() ? Entry.Index->Num() - 1 : 0, Entry.Version, Entry.DerivedIndexes.Num(),
+			Entry.bDirty ? TEXT(", outdated") : TEXT(""), *Pair->Key.ToString());
+	}
+
+	SIZE_T ReportersSize = 0;
+	for (const IRowNameMemoryReporter* Reporter : MemoryReporters)
+	{
+		ReportersSize += Reporter->GetAllocatedSize();
+	}
+	Ar.Logf(TEXT("Open pickers and customizations: %.2f MB in %d, shared indexes not included"),
+		ReportersSize / (1024.0 * 1024.0), MemoryReporters.Num());
+	for (const IRowNameMemoryReporter* Reporter : MemoryReporters)
+	{
+		Ar.Logf(TEXT("  %10.1f KB  %s"), Reporter->GetAllocatedSize() / 1024.0, *Reporter->GetMemoryReportName());
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::Startup()
+{
+	ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FRowNameIndexCache::OnObjectModified);
+	ObjectTransactedHandle = FCoreUObjectDelegates::OnObjectTransacted.AddRaw(this, &FRowNameIndexCache::OnObjectTransacted);
+	AssetsPreDeleteHandle = FEditorDelegates::OnAssetsPreDelete.AddRaw(this, &FRowNameIndexCache::OnAssetsPreDelete);
+	DumpMemoryCommand = IConsoleManager::Get().RegisterConsoleCommand(TEXT("EasyDataTableRowName.DumpMemory"),
+		TEXT("Lists the memory held by cached row name indexes per table and by open row name pickers"),
+		FConsoleCommandWithOutputDeviceDelegate::CreateRaw(this, &FRowNameIndexCache::DumpMemory));
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::Shutdown()
+{
+	FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+	FCoreUObjectDelegates::OnObjectTransacted.Remove(ObjectTransactedHandle);
+	FEditorDelegates::OnAssetsPreDelete.Remove(AssetsPreDeleteHandle);
+	if(DumpMemoryCommand != nullptr)
+	{
+		IConsoleManager::Get().UnregisterConsoleObject(DumpMemoryCommand);
+		DumpMemoryCommand = nullptr;
+	}
+	for (TPair<FSoftObjectPath, FEntry>& Pair : Entries)
+	{
+		ReleaseEntry(Pair.Key, Pair.Value);
+	}
+	Entries.Reset();
+	// Slots still held elsewhere stay valid and read nullptr from now on
+	for (const TPair<FSoftObjectPath, TSharedRef<FRowNameIndexSlot>>& Pair : Slots)
+	{
+		Pair.Value->Publish(nullptr);
+	}
+	Slots.Reset();
+	SlotsToRefresh.Reset();
+	SlotsToCollect.Reset();
+	if(SlotTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SlotTickHandle);
+		SlotTickHandle.Reset();
+	}
+	CompiledFilters.Reset();
+	DisplayProperties.Reset();
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::OnSourceChanged(FSoftObjectPath SourcePath)
+{
+	Invalidate(SourcePath);
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::OnObjectModified(UObject* Object)
+{
+	// Assets without a change delegate (StringTable) are only noticed through Modify / undo
+	if(Entries.Num() == 0 || !FRowNameSourceProviderRegistry::Get().FindProviderForClass(Object->GetClass()).IsValid())
+	{
+		return;
+	}
+	Invalidate(FSoftObjectPath(Object));
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::OnObjectTransacted(UObject* Object,
+	const FTransactionObjectEvent& Event)
+{
+	OnObjectModified(Object);
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::OnAssetsPreDelete(const TArray<UObject*>& Objects)
+{
+	// A pin is a root reference, deleting the table would report it as still in use
+	for (TPair<FSoftObjectPath, FEntry>& Pair : Entries)
+	{
+		if(Pair.Value.PinnedSource.IsValid() && Objects.Contains(Pair.Value.PinnedSource.Get()))
+		{
+			Pair.Value.PinnedSource.Reset();
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::ReleaseEntry(const FSoftObjectPath& SourcePath, FEntry& Entry)
+{
+	// The slot keeps its last snapshot, readers on other threads never see a table disappear; the next build replaces it
+	if(Entry.Provider.IsValid() && Entry.SourceChangedHandle.IsValid())
+	{
+		if(UObject* SourceObject = Entry.SourceObject.Get())
+		{
+			Entry.Provider->UnbindSourceChanged(SourceObject, Entry.SourceChangedHandle);
+		}
+	}
+	Entry.SourceChangedHandle.Reset();
+	Entry.PinnedSource.Reset();
+	Entry.Index.Reset();
+	Entry.DerivedIndexes.Reset();
+	TotalAllocatedSize -= Entry.AllocatedSize;
+	Entry.AllocatedSize = 0;
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::UpdateAllocatedSize(FEntry& Entry)
+{
+	SIZE_T AllocatedSize = Entry.DerivedIndexes.GetAllocatedSize();
+	if(Entry.Index.IsValid())
+	{
+		AllocatedSize += Entry.Index->GetAllocatedSize();
+	}
+	for (const TPair<TPair<FString, FString>, FDerivedIndex>& Pair : Entry.DerivedIndexes)
+	{
+		// Derived indexes that fell back to the full one share it
+		if(Pair.Value.Index.IsValid() && Pair.Value.Index != Entry.Index)
+		{
+			AllocatedSize += Pair.Value.Index->GetAllocatedSize();
+		}
+	}
+	TotalAllocatedSize = TotalAllocatedSize - Entry.AllocatedSize + AllocatedSize;
+	Entry.AllocatedSize = AllocatedSize;
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexCache::TrimToBudget(const FSoftObjectPath& KeepPath)
+{
+	const SIZE_T Budget = static_cast<SIZE_T>(GetDefault<UEasyDataTableRowNameSettings>()->RowNameCacheBudgetMB) * 1024 * 1024;
+	if(Budget == 0 || TotalAllocatedSize <= Budget)
+	{
+		return;
+	}
+
+	TArray<TPair<uint64, FSoftObjectPath>> Candidates;
+	for (const TPair<FSoftObjectPath, FEntry>& Pair : Entries)
+	{
+		// Tables read through a held slot stay, evicting them would leave the slot without refreshes
+		const TSharedRef<FRowNameIndexSlot>* Slot = Slots.Find(Pair.Key);
+		if(Pair.Key != KeepPath && (Slot == nullptr || Slot->IsUnique()))
+		{
+			Candidates.Emplace(Pair.Value.LastAccess, Pair.Key);
+		}
+	}
+	Candidates.Sort([](const TPair<uint64, FSoftObjectPath>& A, const TPair<uint64, FSoftObjectPath>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	for (const TPair<uint64, FSoftObjectPath>& Candidate : Candidates)
+	{
+		if(TotalAllocatedSize <= Budget)
+		{
+			break;
+		}
+		FEntry& Entry = Entries.FindChecked(Candidate.Value);
+		ReleaseEntry(Candidate.Value, Entry);
+		Entries.Remove(Candidate.Value);
+		// Nobody holds the slot, its snapshot would only keep the evicted index alive
+		PublishToSlot(Candidate.Value, nullptr);
+		const TSharedRef<FRowNameIndexSlot>* Slot = Slots.Find(Candidate.Value);
+		if(Slot != nullptr && !(*Slot)->HasRetired())
+		{
+			Slots.Remove(Candidate.Value);
+		}
+	}
+}
@@ -0,0 +1,183 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "RowNameSourceProvider.h"
+#include "RowFilterExpression.h"
+#include "RowNameIndexSlot.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	/**
+	 * Immutable name list of one source asset, shared by every picker of that asset.
+	 * Items always start with NAME_None, search keys are lower-cased once on build.
+	 * Display strings, when given, are stored back to back in one buffer and searched with the names.
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API FRowNameIndex
+	{
+		public:
+			FRowNameIndex(const TArray<FName>& InRowNames, uint32 InVersion, const TArray<FString>& InDisplayStrings = TArray<FString>());
+
+			const TArray<TSharedPtr<FName>>& GetItems() const { return Items; }
+			int32 Num() const { return Items.Num(); }
+			uint32 GetVersion() const { return Version; }
+			SIZE_T GetAllocatedSize() const { return AllocatedSize; }
+
+			bool Contains(const FName& RowName) const;
+
+			/** Display string of RowName, empty when the index has none for it */
+			FStringView GetDisplayString(const FName& RowName) const;
+
+			/** Collects the items whose row name or display string contains SearchText, ignoring case */
+			void Filter(const FString& SearchText, TArray<TSharedPtr<FName>>& OutItems) const;
+
+			/** Every item, NAME_None first, then the rows of PreferredRowNames in that order, then the rest in table order */
+			void OrderFirst(const TArray<FName>& PreferredRowNames, TArray<TSharedPtr<FName>>& OutItems) const;
+
+			/** Row names within MaxDistance edits of Text ignoring case, closest first, at most MaxResults */
+			void FindSimilar(const FString& Text, int32 MaxDistance, int32 MaxResults, TArray<FName>& OutRowNames) const;
+
+		private:
+			TArray<TSharedPtr<FName>> Items;
+			TArray<FString> SearchKeys;
+			/** Row name to its position in Items */
+			TMap<FName, int32> RowIndices;
+			FString DisplayBuffer;
+			/** Start of every item in DisplayBuffer plus the end, empty without display strings */
+			TArray<int32> DisplayOffsets;
+			uint32 Version = 0;
+			/** Computed once on build, the index never changes afterwards */
+			SIZE_T AllocatedSize = 0;
+	};
+
+	/** Holder of row name data outside the cache, such as an open picker, listed by EasyDataTableRowName.DumpMemory */
+	class EASYDATATABLEROWNAMEEDITOR_API IRowNameMemoryReporter
+	{
+		public:
+			virtual ~IRowNameMemoryReporter() = default;
+
+			virtual FString GetMemoryReportName() const = 0;
+			virtual SIZE_T GetAllocatedSize() const = 0;
+	};
+
+	/** Row names of a source captured on the game thread, to build its index on another thread */
+	struct FRowNameIndexBuildTicket
+	{
+		FSoftObjectPath SourcePath;
+		TArray<FName> RowNames;
+		uint32 ChangeSerial = 0;
+		uint32 Version = 0;
+	};
+
+	/**
+	 * Game thread cache of FRowNameIndex keyed by source asset path.
+	 * An index is rebuilt lazily on the first request after its asset changed.
+	 * Sources with a RowFilter or DisplayField get a derived index per (filter, field), built in one
+	 * pass over the rows and kept until the base index version moves on.
+	 * Beyond the memory budget of the settings, the least recently requested tables are dropped;
+	 * pickers still holding their index keep it alive until they close. Pinned sources stay loaded until then.
+	 * Other threads read full indexes through FRowNameIndexSlot, which the cache republishes after
+	 * every change of a source some thread still holds the slot of.
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API FRowNameIndexCache
+	{
+		public:
+			static FRowNameIndexCache& Get();
+
+			/** Returns the shared, filtered when Source has a RowFilter, index of Source, or nullptr when the asset is not loaded */
+			TSharedPtr<const FRowNameIndex> FindOrBuildIndex(const FRowNameSourceRef& Source);
+
+			/** Captures the row names of a loaded source whose index is missing or outdated */
+			bool PrepareBuildTicket(const FRowNameSourceRef& Source, FRowNameIndexBuildTicket& OutTicket);
+
+			/** Installs an index built from Ticket, dropped when the source changed in the meantime */
+			void PublishIndex(const FRowNameIndexBuildTicket& Ticket, const TSharedRef<const FRowNameIndex>& Index);
+
+			/**
+			 * Game thread, the slot other threads read the full index of Source from, built now when the asset is loaded.
+			 * RowFilter and DisplayField of Source are not applied to slots.
+			 */
+			TSharedRef<const FRowNameIndexSlot> AcquireSlot(const FRowNameSourceRef& Source);
+
+			/** Finds the loaded source asset without loading it */
+			UObject* ResolveSourceObject(const FRowNameSourceRef& Source) const;
+
+			void Invalidate(const FSoftObjectPath& SourcePath);
+
+			/** Keeps the source of a cached entry loaded until the entry is dropped, so its index stays usable */
+			void PinSource(const FSoftObjectPath& SourcePath);
+
+			void AddMemoryReporter(const IRowNameMemoryReporter* Reporter);
+			void RemoveMemoryReporter(const IRowNameMemoryReporter* Reporter);
+			void DumpMemory(FOutputDevice& Ar) const;
+			void Startup();
+			void Shutdown();
+
+		private:
+			struct FDerivedIndex
+			{
+				TSharedPtr<const FRowNameIndex> Index;
+				uint32 BaseVersion = 0;
+			};
+
+			struct FEntry
+			{
+				TSharedPtr<const FRowNameSourceProvider> Provider;
+				TWeakObjectPtr<UObject> SourceObject;
+				/** Set by PinSource, for sources nothing else would keep loaded */
+				TStrongObjectPtr<UObject> PinnedSource;
+				TSharedPtr<const FRowNameIndex> Index;
+				FDelegateHandle SourceChangedHandle;
+				uint32 Version = 0;
+				/** Bumped on every invalidation, lets off-thread builds detect they are outdated */
+				uint32 ChangeSerial = 0;
+				bool bDirty = true;
+				/** AccessClock of the last request, 0 for indexes only prewarmed so far */
+				uint64 LastAccess = 0;
+				/** Base and derived indexes together, as counted in TotalAllocatedSize */
+				SIZE_T AllocatedSize = 0;
+				/** Keyed by (RowFilter, DisplayField) */
+				TMap<TPair<FString, FString>, FDerivedIndex> DerivedIndexes;
+			};
+
+			FEntry* BindEntry(const FRowNameSourceRef& Source, UObject*& OutSourceObject);
+			TSharedPtr<const FRowNameIndex> FindOrBuildDerivedIndex(FEntry& Entry, const UObject* SourceObject, const FRowNameSourceRef& Source);
+			TSharedPtr<const FRowFilterExpression> FindOrCompileFilter(const UScriptStruct* RowStruct, const FString& RowFilter);
+			const FProperty* FindDisplayProperty(const UScriptStruct* RowStruct, const FString& DisplayField);
+			static FString ExtractDisplayString(const FProperty* DisplayProperty, const uint8* RowData);
+
+			void OnSourceChanged(FSoftObjectPath SourcePath);
+			void OnObjectModified(UObject* Object);
+			void OnObjectTransacted(UObject* Object, const class FTransactionObjectEvent& Event);
+			void OnAssetsPreDelete(const TArray<UObject*>& Objects);
+			void ReleaseEntry(const FSoftObjectPath& SourcePath, FEntry& Entry);
+			void PublishToSlot(const FSoftObjectPath& SourcePath, const TSharedPtr<const FRowNameIndex>& Index);
+			void ScheduleSlotTick();
+			bool TickSlots(float DeltaTime);
+			void UpdateAllocatedSize(FEntry& Entry);
+			/** Drops least recently used entries until the budget is met, KeepPath is never dropped */
+			void TrimToBudget(const FSoftObjectPath& KeepPath);
+
+			TMap<FSoftObjectPath, FEntry> Entries;
+
+			/** Failed compiles are kept as nullptr so their error is only logged once */
+			TMap<TPair<const UScriptStruct*, FString>, TSharedPtr<const FRowFilterExpression>> CompiledFilters;
+			TMap<TPair<const UScriptStruct*, FString>, const FProperty*> DisplayProperties;
+			FDelegateHandle ObjectModifiedHandle;
+			FDelegateHandle ObjectTransactedHandle;
+			FDelegateHandle AssetsPreDeleteHandle;
+
+			uint64 AccessClock = 0;
+			SIZE_T TotalAllocatedSize = 0;
+			TArray<const IRowNameMemoryReporter*> MemoryReporters;
+
+			TMap<FSoftObjectPath, TSharedRef<FRowNameIndexSlot>> Slots;
+			/** Held slots whose source changed, rebuilt and republished on the next tick */
+			TSet<FSoftObjectPath> SlotsToRefresh;
+			/** Slots whose replaced snapshots still wait for readers */
+			TSet<FSoftObjectPath> SlotsToCollect;
+			FTSTicker::FDelegateHandle SlotTickHandle;
+			IConsoleObject* DumpMemoryCommand = nullptr;
+	};
+}
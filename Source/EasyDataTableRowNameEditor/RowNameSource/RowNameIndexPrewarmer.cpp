@@ -0,0 +1,284 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameIndexPrewarmer.h"
+
+#include "RowNameIndexCache.h"
+#include "RowNameSourceRedirects.h"
+#include "Async/Async.h"
+#include "Batch/RowNameSourceRenameHandler.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Settings/EasyDataTableRowNameSettings.h"
+#include "Tasks/Task.h"
+#include "UObject/UObjectIterator.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	/** Native classes and structs whose metadata is read per frame while gathering */
+	static constexpr int32 StructsPerFrame = 256;
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::Startup()
+{
+	if(!GetDefault<UEasyDataTableRowNameSettings>()->bPrewarmRowNameIndexes)
+	{
+		return;
+	}
+
+	AliveToken = MakeShared<bool>(true);
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	if(AssetRegistry.IsLoadingAssets())
+	{
+		FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FRowNameIndexPrewarmer::OnFilesLoaded);
+	}
+	else
+	{
+		OnFilesLoaded();
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::Shutdown()
+{
+	AliveToken.Reset();
+	if(FilesLoadedHandle.IsValid())
+	{
+		if(FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+		{
+			AssetRegistryModule->Get().OnFilesLoaded().Remove(FilesLoadedHandle);
+		}
+		FilesLoadedHandle.Reset();
+	}
+	if(TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+	PendingStructs.Reset();
+	PendingSources.Reset();
+	KnownSources.Reset();
+	LoadedSources.Reset();
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (TPair<FSoftObjectPath, TObjectPtr<UObject>>& Pair : LoadedSources)
+	{
+		Collector.AddReferencedObject(Pair.Value);
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::OnFilesLoaded()
+{
+	if(FilesLoadedHandle.IsValid())
+	{
+		FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().OnFilesLoaded().Remove(FilesLoadedHandle);
+		FilesLoadedHandle.Reset();
+	}
+
+	GatherSources();
+	if(!PendingStructs.IsEmpty() || !PendingSources.IsEmpty())
+	{
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FRowNameIndexPrewarmer::Tick));
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::GatherSources()
+{
+	// Only the list is taken here, reading the metadata of every native type is spread over the ticks
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if(It->HasAnyClassFlags(CLASS_Native))
+		{
+			PendingStructs.Add(*It);
+		}
+	}
+	for (TObjectIterator<UScriptStruct> It; It; ++It)
+	{
+		if(It->IsNative())
+		{
+			PendingStructs.Add(*It);
+		}
+	}
+	for (TObjectIterator<UBlueprint> It; It; ++It)
+	{
+		GatherBlueprintSources(*It);
+	}
+	GatherTaggedBlueprintSources();
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::GatherTaggedBlueprintSources()
+{
+	// Unloaded Blueprints are only known through the tag written on save, see FRowNameSourceRenameHandler
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.TagsAndValues.Add(FRowNameSourceRenameHandler::SourcesTagName, TOptional<FString>());
+	TArray<FAssetData> Assets;
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get().GetAssets(Filter, Assets);
+
+	const FRowNameSourceProviderRegistry& Registry = FRowNameSourceProviderRegistry::Get();
+	TArray<FString> Paths;
+	for (const FAssetData& Asset : Assets)
+	{
+		FString TagValue;
+		if(!Asset.GetTagValue(FRowNameSourceRenameHandler::SourcesTagName, TagValue))
+		{
+			continue;
+		}
+		Paths.Reset();
+		TagValue.ParseIntoArray(Paths, TEXT(";"));
+		for (const FString& Path : Paths)
+		{
+			FRowNameSourceRef Source;
+			Source.SourcePath = FRowNameSourceRedirects::Get().Resolve(FSoftObjectPath(Path));
+			if(!KnownSources.Contains(Source.SourcePath))
+			{
+				Source.Provider = Registry.FindProviderForPath(Source.SourcePath);
+				AddSource(Source);
+			}
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::GatherStructSources(const UStruct* Struct)
+{
+	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		const FProperty* Property = *It;
+		// Containers of structs and struct properties pass their metadata down, read it from them directly
+		const FRowNameSourceProviderRegistry& Registry = FRowNameSourceProviderRegistry::Get();
+		if(CastField<FArrayProperty>(Property) || CastField<FSetProperty>(Property) || CastField<FStructProperty>(Property))
+		{
+			AddSource(Registry.FindSourceMetaData(Property, ERowNameOptionsSlot::Common));
+		}
+		else if(CastField<FMapProperty>(Property))
+		{
+			AddSource(Registry.FindSourceMetaData(Property, ERowNameOptionsSlot::Key));
+			AddSource(Registry.FindSourceMetaData(Property, ERowNameOptionsSlot::Value));
+		}
+		else if(CastField<FNameProperty>(Property))
+		{
+			AddSource(ResolveRowNameSource(Property));
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::GatherBlueprintSources(const UBlueprint* Blueprint)
+{
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		for (const TSharedRef<FRowNameSourceProvider>& Provider : FRowNameSourceProviderRegistry::Get().GetProviders())
+		{
+			for (const ERowNameOptionsSlot Slot : {ERowNameOptionsSlot::Common, ERowNameOptionsSlot::Key, ERowNameOptionsSlot::Value})
+			{
+				const FName& MetaDataKey = Provider->GetMetaDataKey(Slot);
+				if(Variable.HasMetaData(MetaDataKey))
+				{
+					FRowNameSourceRef Source;
+					Source.Provider = Provider;
+					Source.SourcePath = FRowNameSourceRedirects::Get().Resolve(FSoftObjectPath(Variable.GetMetaData(MetaDataKey)));
+					AddSource(Source);
+				}
+			}
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::AddSource(const FRowNameSourceRef& Source)
+{
+	if(Source.IsValid() && !KnownSources.Contains(Source.SourcePath))
+	{
+		KnownSources.Add(Source.SourcePath);
+		PendingSources.Add(Source);
+	}
+}
+
+bool EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::Tick(float DeltaTime)
+{
+	if(!PendingStructs.IsEmpty())
+	{
+		for (int32 Count = 0; Count < StructsPerFrame && !PendingStructs.IsEmpty(); ++Count)
+		{
+			if(const UStruct* Struct = PendingStructs.Pop(false).Get())
+			{
+				GatherStructSources(Struct);
+			}
+		}
+		return true;
+	}
+
+	const int32 LoadsPerFrame = FMath::Max(1, GetDefault<UEasyDataTableRowNameSettings>()->PrewarmLoadsPerFrame);
+	for (int32 Count = 0; Count < LoadsPerFrame && !PendingSources.IsEmpty(); ++Count)
+	{
+		const FRowNameSourceRef Source = PendingSources.Pop(false);
+		if(FRowNameIndexCache::Get().ResolveSourceObject(Source) != nullptr)
+		{
+			BuildIndexAsync(Source);
+			continue;
+		}
+
+		TWeakPtr<bool> WeakAliveToken = AliveToken;
+		LoadPackageAsync(Source.SourcePath.GetLongPackageName(), FLoadPackageAsyncDelegate::CreateLambda(
+			[this, WeakAliveToken, Source](const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+			{
+				if(WeakAliveToken.IsValid() && Result == EAsyncLoadingResult::Succeeded)
+				{
+					OnSourceLoaded(LoadedPackage, Source);
+				}
+			}));
+	}
+
+	if(PendingSources.IsEmpty())
+	{
+		TickHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::OnSourceLoaded(UPackage* LoadedPackage, FRowNameSourceRef Source)
+{
+	if(UObject* SourceObject = FRowNameIndexCache::Get().ResolveSourceObject(Source))
+	{
+		LoadedSources.Add(Source.SourcePath, SourceObject);
+		BuildIndexAsync(Source);
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::ReleaseLoadedSource(const FSoftObjectPath& SourcePath)
+{
+	// The cache only finds loaded sources, dropped here the table would be collected with its index unused
+	if(LoadedSources.Remove(SourcePath) > 0)
+	{
+		FRowNameIndexCache::Get().PinSource(SourcePath);
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexPrewarmer::BuildIndexAsync(const FRowNameSourceRef& Source)
+{
+	// Row names are read here on the game thread, the index itself is built off it
+	FRowNameIndexBuildTicket Ticket;
+	if(!FRowNameIndexCache::Get().PrepareBuildTicket(Source, Ticket))
+	{
+		ReleaseLoadedSource(Source.SourcePath);
+		return;
+	}
+
+	TWeakPtr<bool> WeakAliveToken = AliveToken;
+	UE::Tasks::Launch(TEXT("EasyDataTableRowName.Prewarm"), [this, Ticket = MoveTemp(Ticket), WeakAliveToken]() mutable
+	{
+		TSharedRef<const FRowNameIndex> Index = MakeShared<const FRowNameIndex>(Ticket.RowNames, Ticket.Version);
+		Ticket.RowNames.Empty();
+		AsyncTask(ENamedThreads::GameThread, [this, Ticket = MoveTemp(Ticket), Index, WeakAliveToken]()
+		{
+			// The token only dies on the game thread, while it lives the prewarmer does too
+			if(WeakAliveToken.IsValid())
+			{
+				FRowNameIndexCache::Get().PublishIndex(Ticket, Index);
+				ReleaseLoadedSource(Ticket.SourcePath);
+			}
+		});
+	}, UE::Tasks::ETaskPriority::BackgroundLow);
+}
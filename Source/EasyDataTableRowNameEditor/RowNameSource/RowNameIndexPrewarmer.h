@@ -0,0 +1,56 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "RowNameSourceProvider.h"
+#include "UObject/GCObject.h"
+
+class UBlueprint;
+class UPackage;
+
+namespace EasyDataTableRowName::Editor
+{
+	/**
+	 * Optional startup pass filling FRowNameIndexCache before the first picker opens.
+	 * Waits for the asset registry scan, gathers sources referenced by row name metadata of native types
+	 * (a few per frame) and of Blueprints (from their EasyRowNameSources tag, without loading them), loads
+	 * the sources asynchronously a few per frame and builds their indexes on low priority tasks.
+	 * A source loaded here is handed to FRowNameIndexCache once its index is published, which keeps it
+	 * loaded until the cache budget drops the entry; otherwise GC would unload it and the index go unused.
+	 * Owned by the module, which creates it on startup and destroys it on shutdown.
+	 */
+	class FRowNameIndexPrewarmer : public FGCObject
+	{
+		public:
+			void Startup();
+			void Shutdown();
+
+			virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+			virtual FString GetReferencerName() const override { return TEXT("EasyDataTableRowName::FRowNameIndexPrewarmer"); }
+
+		private:
+			void OnFilesLoaded();
+			void GatherSources();
+			void GatherTaggedBlueprintSources();
+			void GatherStructSources(const UStruct* Struct);
+			void GatherBlueprintSources(const UBlueprint* Blueprint);
+			void AddSource(const FRowNameSourceRef& Source);
+
+			bool Tick(float DeltaTime);
+			void OnSourceLoaded(UPackage* LoadedPackage, FRowNameSourceRef Source);
+			void BuildIndexAsync(const FRowNameSourceRef& Source);
+			void ReleaseLoadedSource(const FSoftObjectPath& SourcePath);
+
+			/** Native classes and structs whose metadata is still to be read, consumed a few per frame */
+			TArray<TWeakObjectPtr<const UStruct>> PendingStructs;
+			TArray<FRowNameSourceRef> PendingSources;
+			TSet<FSoftObjectPath> KnownSources;
+			/** Sources loaded by the prewarmer, referenced until their index is published and the cache pins them */
+			TMap<FSoftObjectPath, TObjectPtr<UObject>> LoadedSources;
+
+			/** Lets queued loads and tasks notice the prewarmer was shut down */
+			TSharedPtr<bool> AliveToken;
+			FDelegateHandle FilesLoadedHandle;
+			FTSTicker::FDelegateHandle TickHandle;
+	};
+}
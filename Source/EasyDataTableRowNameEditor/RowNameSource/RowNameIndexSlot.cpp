@@ -0,0 +1,56 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameIndexSlot.h"
+
+#include "RowNameIndexCache.h"
+
+EasyDataTableRowName::Editor::FRowNameIndexSlot::~FRowNameIndexSlot()
+{
+	// Readers hold a reference to the slot itself, none can be inside Read() any more
+	delete Current.load();
+	for (const FRetiredSnapshot& RetiredSnapshot : Retired)
+	{
+		delete RetiredSnapshot.Snapshot;
+	}
+}
+
+TSharedPtr<const EasyDataTableRowName::Editor::FRowNameIndex> EasyDataTableRowName::Editor::FRowNameIndexSlot::Read() const
+{
+	// A reader counted before the swap is waited for, one counted after it can only load the new snapshot
+	std::atomic<int32>& Readers = ActiveReaders[Epoch.load() & 1];
+	Readers.fetch_add(1);
+	const FSnapshot* Snapshot = Current.load();
+	TSharedPtr<const FRowNameIndex> Index = Snapshot != nullptr ? Snapshot->Index : nullptr;
+	Readers.fetch_sub(1);
+	return Index;
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexSlot::Publish(const TSharedPtr<const FRowNameIndex>& Index)
+{
+	check(IsInGameThread());
+	FSnapshot* Snapshot = Index.IsValid() ? new FSnapshot{Index} : nullptr;
+	if(FSnapshot* Replaced = Current.exchange(Snapshot))
+	{
+		Retired.Add(FRetiredSnapshot{Replaced});
+	}
+	Epoch.fetch_add(1);
+	CollectRetired();
+}
+
+void EasyDataTableRowName::Editor::FRowNameIndexSlot::CollectRetired()
+{
+	check(IsInGameThread());
+	const bool bEmpty[2] = { ActiveReaders[0].load() == 0, ActiveReaders[1].load() == 0 };
+	for (int32 Index = Retired.Num() - 1; Index >= 0; --Index)
+	{
+		FRetiredSnapshot& RetiredSnapshot = Retired[Index];
+		RetiredSnapshot.bDrained[0] |= bEmpty[0];
+		RetiredSnapshot.bDrained[1] |= bEmpty[1];
+		if(RetiredSnapshot.bDrained[0] && RetiredSnapshot.bDrained[1])
+		{
+			delete RetiredSnapshot.Snapshot;
+			Retired.RemoveAtSwap(Index, 1, false);
+		}
+	}
+}
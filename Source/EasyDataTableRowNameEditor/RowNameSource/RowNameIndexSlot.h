@@ -0,0 +1,61 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+namespace EasyDataTableRowName::Editor
+{
+	class FRowNameIndex;
+
+	/**
+	 * Latest published FRowNameIndex of one source, readable from any thread.
+	 * Readers never lock: they register on the reader counter of the current epoch, copy the shared
+	 * pointer and leave. The game thread swaps the snapshot atomically and frees a replaced one only
+	 * once both counters were seen empty afterwards, so it never waits for readers and readers never
+	 * see a freed snapshot.
+	 * Get the slot on the game thread from FRowNameIndexCache::AcquireSlot and keep it as long as needed.
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API FRowNameIndexSlot
+	{
+		public:
+			FRowNameIndexSlot() = default;
+			~FRowNameIndexSlot();
+
+			FRowNameIndexSlot(const FRowNameIndexSlot&) = delete;
+			FRowNameIndexSlot& operator=(const FRowNameIndexSlot&) = delete;
+
+			/** Any thread, the snapshot current at the time of the call, nullptr before the first build or after shutdown */
+			TSharedPtr<const FRowNameIndex> Read() const;
+
+			/** Game thread, replaces the snapshot seen by later reads */
+			void Publish(const TSharedPtr<const FRowNameIndex>& Index);
+
+			/** Game thread, frees replaced snapshots no reader can still be copying */
+			void CollectRetired();
+
+			/** Game thread, whether replaced snapshots still wait for readers */
+			bool HasRetired() const { return !Retired.IsEmpty(); }
+
+		private:
+			struct FSnapshot
+			{
+				TSharedPtr<const FRowNameIndex> Index;
+			};
+
+			struct FRetiredSnapshot
+			{
+				FSnapshot* Snapshot = nullptr;
+				/** Whether each reader counter was seen at zero since the snapshot was replaced */
+				bool bDrained[2] = { false, false };
+			};
+
+			std::atomic<FSnapshot*> Current { nullptr };
+			/** Bumped on every publish, new readers then count on the other side while the old side drains */
+			std::atomic<uint32> Epoch { 0 };
+			/** Readers inside Read(), by parity of the epoch they registered in */
+			mutable std::atomic<int32> ActiveReaders[2] = { {0}, {0} };
+
+			/** Game thread only */
+			TArray<FRetiredSnapshot> Retired;
+	};
+}
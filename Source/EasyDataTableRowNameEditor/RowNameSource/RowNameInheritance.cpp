@@ -0,0 +1,220 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameInheritance.h"
+
+#include "RowNameSourceRedirects.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	/** Containers and structs walked below the tagged property before giving up, guards recursive struct rules */
+	static constexpr int32 MaxInheritanceDepth = 8;
+}
+
+EasyDataTableRowName::Editor::FRowNameInheritance& EasyDataTableRowName::Editor::FRowNameInheritance::Get()
+{
+	static FRowNameInheritance Inheritance;
+	return Inheritance;
+}
+
+void EasyDataTableRowName::Editor::FRowNameInheritance::Startup()
+{
+	// Recompiled Blueprints and reloaded native code free their properties, cached keys could be reused
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FRowNameInheritance::OnObjectsReplaced);
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FRowNameInheritance::OnReloadComplete);
+	// Unloaded Blueprint classes free their properties without being replaced, another property may take the address
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FRowNameInheritance::OnPostGarbageCollect);
+}
+
+void EasyDataTableRowName::Editor::FRowNameInheritance::Shutdown()
+{
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	ObjectsReplacedHandle.Reset();
+	ReloadCompleteHandle.Reset();
+	PostGarbageCollectHandle.Reset();
+	StructMembers.Reset();
+	ClearCache();
+}
+
+void EasyDataTableRowName::Editor::FRowNameInheritance::RegisterStructMember(const UScriptStruct* Struct,
+	const FName& MemberName)
+{
+	if(Struct != nullptr)
+	{
+		StructMembers.Add(Struct, MemberName);
+		ClearCache();
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameInheritance::UnregisterStructMember(const UScriptStruct* Struct)
+{
+	if(StructMembers.Remove(Struct) > 0)
+	{
+		ClearCache();
+	}
+}
+
+EasyDataTableRowName::Editor::FRowNameSourceRef EasyDataTableRowName::Editor::FRowNameInheritance::Resolve(
+	const FProperty* OuterProperty, const FProperty* InnerProperty)
+{
+	const TPair<const FProperty*, const FProperty*> Key(OuterProperty, InnerProperty);
+	const FRowNameSourceRef* Cached = ResolvedSources.Find(Key);
+	if(Cached == nullptr)
+	{
+		Cached = &ResolvedSources.Add(Key, ResolveUncached(OuterProperty, InnerProperty));
+	}
+
+	// Redirects are added by renames after the pair was cached
+	FRowNameSourceRef Source = *Cached;
+	if(!Source.SourcePath.IsNull())
+	{
+		Source.SourcePath = FRowNameSourceRedirects::Get().Resolve(Source.SourcePath);
+	}
+	return Source;
+}
+
+void EasyDataTableRowName::Editor::FRowNameInheritance::ClearCache()
+{
+	ResolvedSources.Reset();
+}
+
+EasyDataTableRowName::Editor::FRowNameSourceRef EasyDataTableRowName::Editor::FRowNameInheritance::ResolveUncached(
+	const FProperty* OuterProperty, const FProperty* InnerProperty) const
+{
+	if(OuterProperty == nullptr || CastField<FNameProperty>(InnerProperty) == nullptr)
+	{
+		return FRowNameSourceRef();
+	}
+
+	TArray<TPair<const FProperty*, ERowNameOptionsSlot>, TInlineAllocator<2>> Elements;
+	if(const FMapProperty* MapProperty = CastField<FMapProperty>(OuterProperty))
+	{
+		Elements.Emplace(MapProperty->GetKeyProperty(), ERowNameOptionsSlot::Key);
+		Elements.Emplace(MapProperty->GetValueProperty(), ERowNameOptionsSlot::Value);
+	}
+	else if(const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(OuterProperty))
+	{
+		Elements.Emplace(ArrayProperty->Inner, ERowNameOptionsSlot::Common);
+	}
+	else if(const FSetProperty* SetProperty = CastField<FSetProperty>(OuterProperty))
+	{
+		Elements.Emplace(SetProperty->GetElementProperty(), ERowNameOptionsSlot::Common);
+	}
+	else if(CastField<FStructProperty>(OuterProperty))
+	{
+		Elements.Emplace(OuterProperty, ERowNameOptionsSlot::Common);
+	}
+
+	const FRowNameSourceProviderRegistry& Registry = FRowNameSourceProviderRegistry::Get();
+	for (const TPair<const FProperty*, ERowNameOptionsSlot>& Element : Elements)
+	{
+		// FNames held by the container itself read its metadata directly, see ResolveRowNameSource
+		if(Element.Key == InnerProperty)
+		{
+			continue;
+		}
+		FRowNameSourceRef Source = Registry.FindSourceMetaData(OuterProperty, Element.Value);
+		if(!Source.Provider.IsValid())
+		{
+			continue;
+		}
+		TArray<FString> MemberPath;
+		OuterProperty->GetMetaData(GetRowNameMemberMetaDataKey(Element.Value)).ParseIntoArray(MemberPath, TEXT("."));
+		if(LeadsTo(Element.Key, InnerProperty, MemberPath, 0, 0))
+		{
+			return Source;
+		}
+	}
+	return FRowNameSourceRef();
+}
+
+bool EasyDataTableRowName::Editor::FRowNameInheritance::LeadsTo(const FProperty* Property,
+	const FProperty* InnerProperty, const TArray<FString>& MemberPath, int32 PathIndex, int32 Depth) const
+{
+	if(Property == InnerProperty)
+	{
+		return true;
+	}
+	if(Property == nullptr || Depth >= MaxInheritanceDepth)
+	{
+		return false;
+	}
+
+	if(const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		return LeadsTo(ArrayProperty->Inner, InnerProperty, MemberPath, PathIndex, Depth + 1);
+	}
+	if(const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		return LeadsTo(SetProperty->GetElementProperty(), InnerProperty, MemberPath, PathIndex, Depth + 1);
+	}
+	if(const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		return LeadsTo(MapProperty->GetKeyProperty(), InnerProperty, MemberPath, PathIndex, Depth + 1)
+			|| LeadsTo(MapProperty->GetValueProperty(), InnerProperty, MemberPath, PathIndex, Depth + 1);
+	}
+	if(const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		const FString& ExplicitMemberName = MemberPath.IsValidIndex(PathIndex) ? MemberPath[PathIndex] : FString();
+		const FProperty* Member = FindInheritingMember(StructProperty->Struct, ExplicitMemberName);
+		return LeadsTo(Member, InnerProperty, MemberPath, PathIndex + 1, Depth + 1);
+	}
+	return false;
+}
+
+const FProperty* EasyDataTableRowName::Editor::FRowNameInheritance::FindInheritingMember(const UScriptStruct* Struct,
+	const FString& ExplicitMemberName) const
+{
+	if(Struct == nullptr)
+	{
+		return nullptr;
+	}
+
+	FString MemberName = ExplicitMemberName;
+	if(MemberName.IsEmpty())
+	{
+		if(const FName* RegisteredMember = StructMembers.Find(Struct))
+		{
+			MemberName = RegisteredMember->ToString();
+		}
+		else
+		{
+			MemberName = Struct->GetMetaData(MD_RowNameMember);
+		}
+	}
+	if(!MemberName.IsEmpty())
+	{
+		const FProperty* Member = FindFProperty<FProperty>(Struct, *MemberName);
+		UE_CLOG(Member == nullptr, LogEasyDataTableRowName, Warning, TEXT("RowNameMember \"%s\" is not a member of %s"),
+			*MemberName, *Struct->GetName());
+		return Member;
+	}
+
+	const FProperty* OnlyNameMember = nullptr;
+	for (TFieldIterator<FNameProperty> It(Struct); It; ++It)
+	{
+		if(OnlyNameMember != nullptr)
+		{
+			return nullptr;
+		}
+		OnlyNameMember = *It;
+	}
+	return OnlyNameMember;
+}
+
+void EasyDataTableRowName::Editor::FRowNameInheritance::OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacedObjects)
+{
+	ClearCache();
+}
+
+void EasyDataTableRowName::Editor::FRowNameInheritance::OnReloadComplete(EReloadCompleteReason Reason)
+{
+	ClearCache();
+}
+
+void EasyDataTableRowName::Editor::FRowNameInheritance::OnPostGarbageCollect()
+{
+	ClearCache();
+}
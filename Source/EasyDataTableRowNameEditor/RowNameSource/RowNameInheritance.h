@@ -0,0 +1,55 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "RowNameSourceProvider.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	/**
+	 * Row name metadata passed down from a struct, container or map property to an FName nested below it,
+	 * e.g. OptionsFromDataTable on a TArray<FItemRef> reaching FItemRef::Id of every element.
+	 * Which member of a struct receives the metadata is decided per struct type, in this order:
+	 * the RowNameMember metadata of the tagged property ("Ref.Id" walks several struct levels),
+	 * a rule registered with RegisterStructMember, RowNameMember on the USTRUCT, its only FName member.
+	 * Results are cached per (outer property, inner property), every element row shares one lookup.
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API FRowNameInheritance
+	{
+		public:
+			static FRowNameInheritance& Get();
+
+			void Startup();
+			void Shutdown();
+
+			/** Member of Struct receiving inherited row name metadata, for structs whose declaration cannot be tagged */
+			void RegisterStructMember(const UScriptStruct* Struct, const FName& MemberName);
+			void UnregisterStructMember(const UScriptStruct* Struct);
+
+			/**
+			 * Source InnerProperty inherits from OuterProperty, an enclosing property anywhere above it.
+			 * Invalid when OuterProperty has no row name metadata or does not pass it down to InnerProperty.
+			 */
+			FRowNameSourceRef Resolve(const FProperty* OuterProperty, const FProperty* InnerProperty);
+
+			/** Call after editing row name metadata of existing properties in place, replaced properties are noticed on their own */
+			void ClearCache();
+
+		private:
+			FRowNameSourceRef ResolveUncached(const FProperty* OuterProperty, const FProperty* InnerProperty) const;
+			bool LeadsTo(const FProperty* Property, const FProperty* InnerProperty, const TArray<FString>& MemberPath, int32 PathIndex, int32 Depth) const;
+			const FProperty* FindInheritingMember(const UScriptStruct* Struct, const FString& ExplicitMemberName) const;
+
+			void OnObjectsReplaced(const TMap<UObject*, UObject*>& ReplacedObjects);
+			void OnReloadComplete(EReloadCompleteReason Reason);
+			void OnPostGarbageCollect();
+
+			TMap<TObjectKey<UScriptStruct>, FName> StructMembers;
+			/** Negative results are cached too, most enclosing properties pass nothing down */
+			TMap<TPair<const FProperty*, const FProperty*>, FRowNameSourceRef> ResolvedSources;
+			FDelegateHandle ObjectsReplacedHandle;
+			FDelegateHandle ReloadCompleteHandle;
+			FDelegateHandle PostGarbageCollectHandle;
+	};
+}
@@ -0,0 +1,380 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameSourceProvider.h"
+
+#include "DataTableEditorUtils.h"
+#include "RowNameSourceRedirects.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/CurveTable.h"
+#include "Engine/DataTable.h"
+#include "Internationalization/StringTable.h"
+#include "Internationalization/StringTableCore.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+
+DEFINE_LOG_CATEGORY(LogEasyDataTableRowName);
+
+const FName& EasyDataTableRowName::Editor::GetSourcePropertyMetaDataKey(ERowNameOptionsSlot Slot)
+{
+	switch (Slot)
+	{
+	case ERowNameOptionsSlot::Key:
+		return MD_KeyOptionsFromProperty;
+	case ERowNameOptionsSlot::Value:
+		return MD_ValueOptionsFromProperty;
+	default:
+		return MD_OptionsFromProperty;
+	}
+}
+
+const FName& EasyDataTableRowName::Editor::GetRowFilterMetaDataKey(ERowNameOptionsSlot Slot)
+{
+	switch (Slot)
+	{
+	case ERowNameOptionsSlot::Key:
+		return MD_KeyRowFilter;
+	case ERowNameOptionsSlot::Value:
+		return MD_ValueRowFilter;
+	default:
+		return MD_RowFilter;
+	}
+}
+
+const FName& EasyDataTableRowName::Editor::GetRowDisplayFieldMetaDataKey(ERowNameOptionsSlot Slot)
+{
+	switch (Slot)
+	{
+	case ERowNameOptionsSlot::Key:
+		return MD_KeyRowDisplayField;
+	case ERowNameOptionsSlot::Value:
+		return MD_ValueRowDisplayField;
+	default:
+		return MD_RowDisplayField;
+	}
+}
+
+const FName& EasyDataTableRowName::Editor::GetRowNameMemberMetaDataKey(ERowNameOptionsSlot Slot)
+{
+	switch (Slot)
+	{
+	case ERowNameOptionsSlot::Key:
+		return MD_KeyRowNameMember;
+	case ERowNameOptionsSlot::Value:
+		return MD_ValueRowNameMember;
+	default:
+		return MD_RowNameMember;
+	}
+}
+
+EasyDataTableRowName::Editor::FRowNameSourceProvider::FRowNameSourceProvider(const FName& InSourceTypeName)
+	: SourceTypeName(InSourceTypeName)
+{
+	const FString TypeString = InSourceTypeName.ToString();
+	MetaDataKeys[static_cast<uint8>(ERowNameOptionsSlot::Common)] = FName(TEXT("OptionsFrom") + TypeString);
+	MetaDataKeys[static_cast<uint8>(ERowNameOptionsSlot::Key)] = FName(TEXT("KeyOptionsFrom") + TypeString);
+	MetaDataKeys[static_cast<uint8>(ERowNameOptionsSlot::Value)] = FName(TEXT("ValueOptionsFrom") + TypeString);
+}
+
+const FName& EasyDataTableRowName::Editor::FRowNameSourceProvider::GetMetaDataKey(ERowNameOptionsSlot Slot) const
+{
+	return MetaDataKeys[static_cast<uint8>(Slot)];
+}
+
+const UScriptStruct* EasyDataTableRowName::Editor::FRowNameSourceProvider::GetRowStruct(const UObject* Source) const
+{
+	return nullptr;
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceProvider::ForEachRow(const UObject* Source,
+	TFunctionRef<void(const FName&, const uint8*)> Visitor) const
+{
+}
+
+FDelegateHandle EasyDataTableRowName::Editor::FRowNameSourceProvider::BindSourceChanged(UObject* Source,
+	const FSimpleDelegate& OnChanged) const
+{
+	return FDelegateHandle();
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceProvider::UnbindSourceChanged(UObject* Source,
+	FDelegateHandle Handle) const
+{
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceProvider::BrowseToRow(UObject* Source, const FName& RowName) const
+{
+	if(IsValid(Source))
+	{
+		GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(Source);
+	}
+}
+
+EasyDataTableRowName::Editor::FDataTableRowNameSourceProvider::FDataTableRowNameSourceProvider()
+	: FRowNameSourceProvider(TEXT("DataTable"))
+{
+}
+
+UClass* EasyDataTableRowName::Editor::FDataTableRowNameSourceProvider::GetSourceClass() const
+{
+	return UDataTable::StaticClass();
+}
+
+void EasyDataTableRowName::Editor::FDataTableRowNameSourceProvider::GetRowNames(const UObject* Source,
+	TArray<FName>& OutRowNames) const
+{
+	if(const UDataTable* DataTable = Cast<UDataTable>(Source))
+	{
+		DataTable->GetRowMap().GetKeys(OutRowNames);
+	}
+}
+
+const UScriptStruct* EasyDataTableRowName::Editor::FDataTableRowNameSourceProvider::GetRowStruct(
+	const UObject* Source) const
+{
+	const UDataTable* DataTable = Cast<UDataTable>(Source);
+	return DataTable != nullptr ? DataTable->GetRowStruct() : nullptr;
+}
+
+void EasyDataTableRowName::Editor::FDataTableRowNameSourceProvider::ForEachRow(const UObject* Source,
+	TFunctionRef<void(const FName&, const uint8*)> Visitor) const
+{
+	if(const UDataTable* DataTable = Cast<UDataTable>(Source))
+	{
+		for (const TPair<FName, uint8*>& Row : DataTable->GetRowMap())
+		{
+			Visitor(Row.Key, Row.Value);
+		}
+	}
+}
+
+FDelegateHandle EasyDataTableRowName::Editor::FDataTableRowNameSourceProvider::BindSourceChanged(UObject* Source,
+	const FSimpleDelegate& OnChanged) const
+{
+	if(UDataTable* DataTable = Cast<UDataTable>(Source))
+	{
+		return DataTable->OnDataTableChanged().Add(OnChanged);
+	}
+	return FDelegateHandle();
+}
+
+void EasyDataTableRowName::Editor::FDataTableRowNameSourceProvider::UnbindSourceChanged(UObject* Source,
+	FDelegateHandle Handle) const
+{
+	if(UDataTable* DataTable = Cast<UDataTable>(Source))
+	{
+		DataTable->OnDataTableChanged().Remove(Handle);
+	}
+}
+
+void EasyDataTableRowName::Editor::FDataTableRowNameSourceProvider::BrowseToRow(UObject* Source,
+	const FName& RowName) const
+{
+	UDataTable* DataTable = Cast<UDataTable>(Source);
+	if(IsValid(DataTable))
+	{
+		GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OpenEditorForAsset(DataTable);
+		if(DataTable->GetRowMap().Contains(RowName))
+		{
+			FDataTableEditorUtils::SelectRow(DataTable,RowName);
+		}
+	}
+}
+
+EasyDataTableRowName::Editor::FCurveTableRowNameSourceProvider::FCurveTableRowNameSourceProvider()
+	: FRowNameSourceProvider(TEXT("CurveTable"))
+{
+}
+
+UClass* EasyDataTableRowName::Editor::FCurveTableRowNameSourceProvider::GetSourceClass() const
+{
+	return UCurveTable::StaticClass();
+}
+
+void EasyDataTableRowName::Editor::FCurveTableRowNameSourceProvider::GetRowNames(const UObject* Source,
+	TArray<FName>& OutRowNames) const
+{
+	if(const UCurveTable* CurveTable = Cast<UCurveTable>(Source))
+	{
+		CurveTable->GetRowMap().GetKeys(OutRowNames);
+	}
+}
+
+FDelegateHandle EasyDataTableRowName::Editor::FCurveTableRowNameSourceProvider::BindSourceChanged(UObject* Source,
+	const FSimpleDelegate& OnChanged) const
+{
+	if(UCurveTable* CurveTable = Cast<UCurveTable>(Source))
+	{
+		return CurveTable->OnCurveTableChanged().Add(OnChanged);
+	}
+	return FDelegateHandle();
+}
+
+void EasyDataTableRowName::Editor::FCurveTableRowNameSourceProvider::UnbindSourceChanged(UObject* Source,
+	FDelegateHandle Handle) const
+{
+	if(UCurveTable* CurveTable = Cast<UCurveTable>(Source))
+	{
+		CurveTable->OnCurveTableChanged().Remove(Handle);
+	}
+}
+
+EasyDataTableRowName::Editor::FStringTableRowNameSourceProvider::FStringTableRowNameSourceProvider()
+	: FRowNameSourceProvider(TEXT("StringTable"))
+{
+}
+
+UClass* EasyDataTableRowName::Editor::FStringTableRowNameSourceProvider::GetSourceClass() const
+{
+	return UStringTable::StaticClass();
+}
+
+void EasyDataTableRowName::Editor::FStringTableRowNameSourceProvider::GetRowNames(const UObject* Source,
+	TArray<FName>& OutRowNames) const
+{
+	const UStringTable* StringTable = Cast<UStringTable>(Source);
+	if(!IsValid(StringTable))
+	{
+		return;
+	}
+	StringTable->GetStringTable()->EnumerateSourceStrings([&OutRowNames](const FString& InKey, const FString& InSourceString)
+	{
+		OutRowNames.Add(FName(*InKey));
+		return true;
+	});
+}
+
+EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry& EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::Get()
+{
+	static FRowNameSourceProviderRegistry Registry;
+	return Registry;
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::RegisterProvider(
+	const TSharedRef<FRowNameSourceProvider>& Provider)
+{
+	UnregisterProvider(Provider->GetSourceTypeName());
+	Providers.Add(Provider);
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::UnregisterProvider(const FName& SourceTypeName)
+{
+	Providers.RemoveAll([&SourceTypeName](const TSharedRef<FRowNameSourceProvider>& Provider)
+	{
+		return Provider->GetSourceTypeName() == SourceTypeName;
+	});
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::Reset()
+{
+	Providers.Reset();
+}
+
+TSharedPtr<const EasyDataTableRowName::Editor::FRowNameSourceProvider> EasyDataTableRowName::Editor::
+FRowNameSourceProviderRegistry::FindProviderForClass(const UClass* Class) const
+{
+	if(Class == nullptr)
+	{
+		return nullptr;
+	}
+	for (const TSharedRef<FRowNameSourceProvider>& Provider : Providers)
+	{
+		if(Class->IsChildOf(Provider->GetSourceClass()))
+		{
+			return Provider;
+		}
+	}
+	return nullptr;
+}
+
+TSharedPtr<const EasyDataTableRowName::Editor::FRowNameSourceProvider> EasyDataTableRowName::Editor::
+FRowNameSourceProviderRegistry::FindProviderForPath(const FSoftObjectPath& Path) const
+{
+	if(Path.IsNull())
+	{
+		return nullptr;
+	}
+	if(const UObject* Object = Path.ResolveObject())
+	{
+		return FindProviderForClass(Object->GetClass());
+	}
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(Path);
+	return AssetData.IsValid() ? FindProviderForClass(AssetData.GetClass()) : nullptr;
+}
+
+TArray<const UClass*> EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::GetSourceClasses() const
+{
+	TArray<const UClass*> Classes;
+	for (const TSharedRef<FRowNameSourceProvider>& Provider : Providers)
+	{
+		Classes.AddUnique(Provider->GetSourceClass());
+	}
+	return Classes;
+}
+
+EasyDataTableRowName::Editor::FRowNameSourceRef EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::
+FindSourceMetaData(const FProperty* Property, ERowNameOptionsSlot Slot) const
+{
+	FRowNameSourceRef Source;
+	if(Property == nullptr)
+	{
+		return Source;
+	}
+	Source.RowFilter = Property->GetMetaData(GetRowFilterMetaDataKey(Slot));
+	Source.DisplayField = Property->GetMetaData(GetRowDisplayFieldMetaDataKey(Slot));
+	for (const TSharedRef<FRowNameSourceProvider>& Provider : Providers)
+	{
+		const FName& MetaDataKey = Provider->GetMetaDataKey(Slot);
+		if(Property->HasMetaData(MetaDataKey))
+		{
+			const FString& Path = Property->GetMetaData(MetaDataKey);
+			if(!Path.IsEmpty())
+			{
+				Source.Provider = Provider;
+				Source.SourcePath = FRowNameSourceRedirects::Get().Resolve(FSoftObjectPath(Path));
+				return Source;
+			}
+		}
+	}
+
+	const FString& SourcePropertyName = Property->GetMetaData(GetSourcePropertyMetaDataKey(Slot));
+	const UStruct* OwnerStruct = Property->GetOwnerStruct();
+	if(!SourcePropertyName.IsEmpty() && OwnerStruct != nullptr)
+	{
+		const FObjectPropertyBase* SourceProperty = FindFProperty<FObjectPropertyBase>(OwnerStruct, *SourcePropertyName);
+		if(SourceProperty != nullptr)
+		{
+			Source.Provider = FindProviderForClass(SourceProperty->PropertyClass);
+			Source.SourcePropertyName = SourceProperty->GetFName();
+		}
+	}
+	return Source;
+}
+
+EasyDataTableRowName::Editor::FRowNameSourceRef EasyDataTableRowName::Editor::ResolveRowNameSource(const FProperty* Property)
+{
+	const FNameProperty* NameProperty = CastField<FNameProperty>(Property);
+	if(NameProperty == nullptr)
+	{
+		return FRowNameSourceRef();
+	}
+
+	const FRowNameSourceProviderRegistry& Registry = FRowNameSourceProviderRegistry::Get();
+	const FProperty* OwnerProperty = Property->GetOwnerProperty();
+	if(const FMapProperty* MapProperty = CastField<FMapProperty>(OwnerProperty))
+	{
+		if(MapProperty->GetKeyProperty() == Property)
+		{
+			return Registry.FindSourceMetaData(MapProperty, ERowNameOptionsSlot::Key);
+		}
+		if(MapProperty->GetValueProperty() == Property)
+		{
+			return Registry.FindSourceMetaData(MapProperty, ERowNameOptionsSlot::Value);
+		}
+		return FRowNameSourceRef();
+	}
+
+	const bool bIsInContainer = CastField<FArrayProperty>(OwnerProperty) != nullptr || CastField<FSetProperty>(OwnerProperty) != nullptr;
+	return Registry.FindSourceMetaData(bIsInContainer ? OwnerProperty : NameProperty, ERowNameOptionsSlot::Common);
+}
@@ -0,0 +1,167 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+EASYDATATABLEROWNAMEEDITOR_API DECLARE_LOG_CATEGORY_EXTERN(LogEasyDataTableRowName, Log, All);
+
+namespace EasyDataTableRowName::Editor
+{
+	/** Metadata naming a sibling UDataTable* / UCurveTable* / UStringTable* property that holds the source */
+	static inline FName MD_OptionsFromProperty = FName("OptionsFromProperty");
+	static inline FName MD_KeyOptionsFromProperty = FName("KeyOptionsFromProperty");
+	static inline FName MD_ValueOptionsFromProperty = FName("ValueOptionsFromProperty");
+
+	/** Metadata restricting the listed rows by row struct fields, see FRowFilterExpression */
+	static inline FName MD_RowFilter = FName("RowFilter");
+	static inline FName MD_KeyRowFilter = FName("KeyRowFilter");
+	static inline FName MD_ValueRowFilter = FName("ValueRowFilter");
+
+	/** Metadata naming a row struct field shown and searched next to the row name */
+	static inline FName MD_RowDisplayField = FName("RowDisplayField");
+	static inline FName MD_KeyRowDisplayField = FName("KeyRowDisplayField");
+	static inline FName MD_ValueRowDisplayField = FName("ValueRowDisplayField");
+
+	/** Metadata on a struct, container or map property naming the struct member its row name metadata is passed down to */
+	static inline FName MD_RowNameMember = FName("RowNameMember");
+	static inline FName MD_KeyRowNameMember = FName("KeyRowNameMember");
+	static inline FName MD_ValueRowNameMember = FName("ValueRowNameMember");
+
+	/** Which metadata family of a property a row name source is read from */
+	enum class ERowNameOptionsSlot : uint8
+	{
+		/** OptionsFromXxx, used by plain FName, TArray<FName> and TSet<FName> */
+		Common,
+		/** KeyOptionsFromXxx, used by TMap<FName,...> keys */
+		Key,
+		/** ValueOptionsFromXxx, used by TMap<...,FName> values */
+		Value,
+	};
+
+	/**
+	 * Supplies row names from one kind of keyed asset (DataTable, CurveTable, StringTable ...).
+	 * Every provider owns its own metadata family, built from the source type name:
+	 * "DataTable" -> OptionsFromDataTable / KeyOptionsFromDataTable / ValueOptionsFromDataTable
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API FRowNameSourceProvider : public TSharedFromThis<FRowNameSourceProvider>
+	{
+		public:
+			explicit FRowNameSourceProvider(const FName& InSourceTypeName);
+			virtual ~FRowNameSourceProvider() = default;
+
+			FName GetSourceTypeName() const { return SourceTypeName; }
+			const FName& GetMetaDataKey(ERowNameOptionsSlot Slot) const;
+
+			/** Asset class accepted by this provider, used by asset pickers and drop targets */
+			virtual UClass* GetSourceClass() const = 0;
+
+			/** Appends all row names of Source in asset order. Game thread only */
+			virtual void GetRowNames(const UObject* Source, TArray<FName>& OutRowNames) const = 0;
+
+			/** Struct of the row memory passed to ForEachRow, nullptr when rows are not structs */
+			virtual const UScriptStruct* GetRowStruct(const UObject* Source) const;
+
+			/** Visits rows in asset order with their struct memory. Game thread only */
+			virtual void ForEachRow(const UObject* Source, TFunctionRef<void(const FName&, const uint8*)> Visitor) const;
+
+			/** Hooks a change notification of Source, if the asset type exposes one */
+			virtual FDelegateHandle BindSourceChanged(UObject* Source, const FSimpleDelegate& OnChanged) const;
+			virtual void UnbindSourceChanged(UObject* Source, FDelegateHandle Handle) const;
+
+			/** Opens the asset editor of Source and focuses RowName where supported */
+			virtual void BrowseToRow(UObject* Source, const FName& RowName) const;
+
+		private:
+			FName SourceTypeName;
+			FName MetaDataKeys[3];
+	};
+
+	class EASYDATATABLEROWNAMEEDITOR_API FDataTableRowNameSourceProvider : public FRowNameSourceProvider
+	{
+		public:
+			FDataTableRowNameSourceProvider();
+
+			virtual UClass* GetSourceClass() const override;
+			virtual void GetRowNames(const UObject* Source, TArray<FName>& OutRowNames) const override;
+			virtual const UScriptStruct* GetRowStruct(const UObject* Source) const override;
+			virtual void ForEachRow(const UObject* Source, TFunctionRef<void(const FName&, const uint8*)> Visitor) const override;
+			virtual FDelegateHandle BindSourceChanged(UObject* Source, const FSimpleDelegate& OnChanged) const override;
+			virtual void UnbindSourceChanged(UObject* Source, FDelegateHandle Handle) const override;
+			virtual void BrowseToRow(UObject* Source, const FName& RowName) const override;
+	};
+
+	class EASYDATATABLEROWNAMEEDITOR_API FCurveTableRowNameSourceProvider : public FRowNameSourceProvider
+	{
+		public:
+			FCurveTableRowNameSourceProvider();
+
+			virtual UClass* GetSourceClass() const override;
+			virtual void GetRowNames(const UObject* Source, TArray<FName>& OutRowNames) const override;
+			virtual FDelegateHandle BindSourceChanged(UObject* Source, const FSimpleDelegate& OnChanged) const override;
+			virtual void UnbindSourceChanged(UObject* Source, FDelegateHandle Handle) const override;
+	};
+
+	class EASYDATATABLEROWNAMEEDITOR_API FStringTableRowNameSourceProvider : public FRowNameSourceProvider
+	{
+		public:
+			FStringTableRowNameSourceProvider();
+
+			virtual UClass* GetSourceClass() const override;
+			virtual void GetRowNames(const UObject* Source, TArray<FName>& OutRowNames) const override;
+	};
+
+	EASYDATATABLEROWNAMEEDITOR_API const FName& GetSourcePropertyMetaDataKey(ERowNameOptionsSlot Slot);
+	EASYDATATABLEROWNAMEEDITOR_API const FName& GetRowFilterMetaDataKey(ERowNameOptionsSlot Slot);
+	EASYDATATABLEROWNAMEEDITOR_API const FName& GetRowDisplayFieldMetaDataKey(ERowNameOptionsSlot Slot);
+	EASYDATATABLEROWNAMEEDITOR_API const FName& GetRowNameMemberMetaDataKey(ERowNameOptionsSlot Slot);
+
+	/**
+	 * A resolved metadata reference: which provider and which asset a property picks its names from.
+	 * Sources read from a sibling property only know the property until an instance is available,
+	 * see IsDynamic(); SourcePath is filled in by whoever can read that instance.
+	 */
+	struct EASYDATATABLEROWNAMEEDITOR_API FRowNameSourceRef
+	{
+		TSharedPtr<const FRowNameSourceProvider> Provider;
+		FSoftObjectPath SourcePath;
+
+		/** Sibling property holding the source object, set for OptionsFromProperty */
+		FName SourcePropertyName;
+
+		/** RowFilter expression text, empty lists every row */
+		FString RowFilter;
+
+		/** Row struct field shown next to each row name, empty shows the name only */
+		FString DisplayField;
+
+		bool IsValid() const { return Provider.IsValid() && !SourcePath.IsNull(); }
+		bool IsDynamic() const { return Provider.IsValid() && !SourcePropertyName.IsNone(); }
+	};
+
+	class EASYDATATABLEROWNAMEEDITOR_API FRowNameSourceProviderRegistry
+	{
+		public:
+			static FRowNameSourceProviderRegistry& Get();
+
+			void RegisterProvider(const TSharedRef<FRowNameSourceProvider>& Provider);
+			void UnregisterProvider(const FName& SourceTypeName);
+			void Reset();
+
+			const TArray<TSharedRef<FRowNameSourceProvider>>& GetProviders() const { return Providers; }
+			TSharedPtr<const FRowNameSourceProvider> FindProviderForClass(const UClass* Class) const;
+
+			/** Provider of the asset at Path, from the loaded object or the asset registry class */
+			TSharedPtr<const FRowNameSourceProvider> FindProviderForPath(const FSoftObjectPath& Path) const;
+
+			/** Every asset class some provider accepts */
+			TArray<const UClass*> GetSourceClasses() const;
+
+			/** Reads the metadata family of Slot on Property, first registered provider wins, then OptionsFromProperty */
+			FRowNameSourceRef FindSourceMetaData(const FProperty* Property, ERowNameOptionsSlot Slot) const;
+
+		private:
+			TArray<TSharedRef<FRowNameSourceProvider>> Providers;
+	};
+
+	/** Resolves the row name source of an FName property, looking through its Array/Set/Map owner */
+	EASYDATATABLEROWNAMEEDITOR_API FRowNameSourceRef ResolveRowNameSource(const FProperty* Property);
+}
@@ -0,0 +1,63 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameSourceRedirects.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/ObjectRedirector.h"
+
+EasyDataTableRowName::Editor::FRowNameSourceRedirects& EasyDataTableRowName::Editor::FRowNameSourceRedirects::Get()
+{
+	static FRowNameSourceRedirects Redirects;
+	return Redirects;
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRedirects::AddRedirect(const FSoftObjectPath& OldPath,
+	const FSoftObjectPath& NewPath)
+{
+	if(OldPath.IsNull() || OldPath == NewPath)
+	{
+		return;
+	}
+	// Moving an asset back to where it came from must not leave a cycle
+	Redirects.Remove(NewPath);
+	Redirects.Add(OldPath, NewPath);
+}
+
+FSoftObjectPath EasyDataTableRowName::Editor::FRowNameSourceRedirects::Resolve(const FSoftObjectPath& Path) const
+{
+	FSoftObjectPath Resolved = Path;
+	const FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry");
+	for (int32 Depth = 0; Depth < 16; ++Depth)
+	{
+		if(const FSoftObjectPath* Redirected = Redirects.Find(Resolved))
+		{
+			Resolved = *Redirected;
+			continue;
+		}
+		const UObject* Object = Resolved.ResolveObject();
+		const UObjectRedirector* Redirector = Cast<UObjectRedirector>(Object);
+		if(Redirector != nullptr && Redirector->DestinationObject != nullptr)
+		{
+			Resolved = FSoftObjectPath(Redirector->DestinationObject);
+			continue;
+		}
+		// Redirector packages of earlier sessions are not loaded, their registry entry holds the destination
+		if(Object == nullptr && AssetRegistryModule != nullptr)
+		{
+			const FSoftObjectPath Redirected = AssetRegistryModule->Get().GetRedirectedObjectPath(Resolved);
+			if(!Redirected.IsNull() && Redirected != Resolved)
+			{
+				Resolved = Redirected;
+				continue;
+			}
+		}
+		break;
+	}
+	return Resolved;
+}
+
+void EasyDataTableRowName::Editor::FRowNameSourceRedirects::Reset()
+{
+	Redirects.Reset();
+}
@@ -0,0 +1,28 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	/**
+	 * Where renamed or moved source assets went, for metadata still holding the old path.
+	 * Blueprint metadata is rewritten on rename, C++ metadata can only be redirected. Renames of this
+	 * session are held here, older ones are followed through loaded object redirectors or, unloaded,
+	 * through the redirectors the asset registry knows, so C++ paths keep resolving after a restart.
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API FRowNameSourceRedirects
+	{
+		public:
+			static FRowNameSourceRedirects& Get();
+
+			void AddRedirect(const FSoftObjectPath& OldPath, const FSoftObjectPath& NewPath);
+
+			/** Path at the end of the redirect chain of Path, Path itself when it was not moved */
+			FSoftObjectPath Resolve(const FSoftObjectPath& Path) const;
+
+			void Reset();
+
+		private:
+			TMap<FSoftObjectPath, FSoftObjectPath> Redirects;
+	};
+}
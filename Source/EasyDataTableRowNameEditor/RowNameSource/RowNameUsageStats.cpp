@@ -0,0 +1,356 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "RowNameUsageStats.h"
+
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Settings/EasyDataTableRowNameSettings.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	static constexpr int32 RowNameUsageFileVersion = 1;
+	/** Seconds between writes of the stats file while it has unsaved changes, an editor crash loses at most this */
+	static constexpr float RowNameUsageSaveInterval = 30.0f;
+	static constexpr int32 PackagesCountedPerFrame = 16;
+}
+
+EasyDataTableRowName::Editor::FRowNameUsageStats& EasyDataTableRowName::Editor::FRowNameUsageStats::Get()
+{
+	static FRowNameUsageStats Stats;
+	return Stats;
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::Startup()
+{
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FRowNameUsageStats::OnPackageSaved);
+	AssetLoadedHandle = FCoreUObjectDelegates::OnAssetLoaded.AddRaw(this, &FRowNameUsageStats::OnAssetLoaded);
+	SaveTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FRowNameUsageStats::SaveIfDirty), RowNameUsageSaveInterval);
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::Shutdown()
+{
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+	PackageSavedHandle.Reset();
+	FCoreUObjectDelegates::OnAssetLoaded.Remove(AssetLoadedHandle);
+	AssetLoadedHandle.Reset();
+	for (FTSTicker::FDelegateHandle* Handle : {&CountTickHandle, &SaveTickHandle})
+	{
+		if(Handle->IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(*Handle);
+			Handle->Reset();
+		}
+	}
+	PackagesToCount.Reset();
+	if(bDirty)
+	{
+		Save();
+	}
+	Sources.Reset();
+	Packages.Reset();
+	bLoaded = false;
+	bDirty = false;
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::RecordPick(const FSoftObjectPath& SourcePath, const FName& RowName)
+{
+	if(SourcePath.IsNull() || RowName.IsNone())
+	{
+		return;
+	}
+	Load();
+
+	const int32 MaxRecentPicks = GetDefault<UEasyDataTableRowNameSettings>()->RecentRowPickCount;
+	TArray<FName>& RecentPicks = Sources.FindOrAdd(SourcePath).RecentPicks;
+	RecentPicks.Remove(RowName);
+	RecentPicks.Insert(RowName, 0);
+	if(RecentPicks.Num() > MaxRecentPicks)
+	{
+		RecentPicks.SetNum(FMath::Max(0, MaxRecentPicks));
+	}
+	bDirty = true;
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::GetPreferredRowNames(const FSoftObjectPath& SourcePath,
+	int32 MaxCount, TArray<FName>& OutRowNames)
+{
+	OutRowNames.Reset();
+	Load();
+	FSourceUsage* Usage = Sources.Find(SourcePath);
+	if(Usage == nullptr)
+	{
+		return;
+	}
+
+	if(Usage->bMostUsedDirty)
+	{
+		Usage->Counts.ValueSort([](int32 A, int32 B) { return A > B; });
+		Usage->Counts.GenerateKeyArray(Usage->MostUsed);
+		Usage->bMostUsedDirty = false;
+	}
+
+	for (const FName& RowName : Usage->RecentPicks)
+	{
+		if(OutRowNames.Num() >= MaxCount)
+		{
+			return;
+		}
+		OutRowNames.Add(RowName);
+	}
+	for (const FName& RowName : Usage->MostUsed)
+	{
+		if(OutRowNames.Num() >= MaxCount)
+		{
+			return;
+		}
+		OutRowNames.AddUnique(RowName);
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::OnPackageSaved(const FString& PackageFileName, UPackage* Package,
+	FObjectPostSaveContext SaveContext)
+{
+	if(Package == nullptr || SaveContext.IsProceduralSave())
+	{
+		return;
+	}
+	Load();
+
+	FPackageUsage NewUsage;
+	CountPackage(Package, NewUsage);
+	const FName PackageName = Package->GetFName();
+	if(const FPackageUsage* OldUsage = Packages.Find(PackageName))
+	{
+		ApplyPackageUsage(*OldUsage, -1);
+	}
+	ApplyPackageUsage(NewUsage, 1);
+	Packages.Add(PackageName, MoveTemp(NewUsage));
+	bDirty = true;
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::OnAssetLoaded(UObject* Asset)
+{
+	// Saved packages are already known, the save replaces their counts anyway
+	UPackage* Package = Asset != nullptr ? Asset->GetPackage() : nullptr;
+	if(Package == nullptr || Package->HasAnyPackageFlags(PKG_CompiledIn) || !FPackageName::IsValidLongPackageName(Package->GetName()))
+	{
+		return;
+	}
+	PackagesToCount.AddUnique(Package);
+	if(!CountTickHandle.IsValid())
+	{
+		CountTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FRowNameUsageStats::CountLoadedPackages));
+	}
+}
+
+bool EasyDataTableRowName::Editor::FRowNameUsageStats::CountLoadedPackages(float DeltaTime)
+{
+	Load();
+	for (int32 Count = 0; Count < PackagesCountedPerFrame && !PackagesToCount.IsEmpty(); ++Count)
+	{
+		UPackage* Package = PackagesToCount.Pop(false).Get();
+		if(Package == nullptr || Packages.Contains(Package->GetFName()))
+		{
+			continue;
+		}
+		FPackageUsage Usage;
+		CountPackage(Package, Usage);
+		ApplyPackageUsage(Usage, 1);
+		// Empty usage is recorded too, so the package is not counted again next session
+		Packages.Add(Package->GetFName(), MoveTemp(Usage));
+		bDirty = true;
+	}
+	if(PackagesToCount.IsEmpty())
+	{
+		CountTickHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool EasyDataTableRowName::Editor::FRowNameUsageStats::SaveIfDirty(float DeltaTime)
+{
+	if(bDirty)
+	{
+		Save();
+		bDirty = false;
+	}
+	return true;
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::CountPackage(UPackage* Package, FPackageUsage& OutUsage)
+{
+	ForEachObjectWithPackage(Package, [&OutUsage](UObject* Object)
+	{
+		CountObject(Object, OutUsage);
+		return true;
+	}, true, RF_Transient, EInternalObjectFlags::Garbage);
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::CountObject(const UObject* Object, FPackageUsage& OutUsage)
+{
+	const UClass* Class = Object->GetClass();
+	auto CountName = [Object, Class, &OutUsage](const FProperty* NameProperty, const FName& RowName)
+	{
+		if(RowName.IsNone())
+		{
+			return;
+		}
+		FRowNameSourceRef Source = ResolveRowNameSource(NameProperty);
+		if(Source.IsDynamic())
+		{
+			const FObjectPropertyBase* SourceProperty = FindFProperty<FObjectPropertyBase>(Class, Source.SourcePropertyName);
+			Source.SourcePath = SourceProperty != nullptr ? FSoftObjectPath(SourceProperty->GetObjectPropertyValue_InContainer(Object)) : FSoftObjectPath();
+		}
+		if(Source.IsValid())
+		{
+			++OutUsage.FindOrAdd(Source.SourcePath).FindOrAdd(RowName);
+		}
+	};
+
+	for (TFieldIterator<FProperty> It(Class); It; ++It)
+	{
+		const FProperty* Property = *It;
+		const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Object);
+		if(CastField<FNameProperty>(Property))
+		{
+			CountName(Property, *static_cast<const FName*>(ValuePtr));
+		}
+		else if(const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			if(CastField<FNameProperty>(ArrayProperty->Inner))
+			{
+				FScriptArrayHelper ArrayHelper(ArrayProperty, ValuePtr);
+				for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+				{
+					CountName(ArrayProperty->Inner, *reinterpret_cast<const FName*>(ArrayHelper.GetRawPtr(Index)));
+				}
+			}
+		}
+		else if(const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			if(CastField<FNameProperty>(SetProperty->GetElementProperty()))
+			{
+				FScriptSetHelper SetHelper(SetProperty, ValuePtr);
+				for (FScriptSetHelper::FIterator SetIt(SetHelper); SetIt; ++SetIt)
+				{
+					CountName(SetProperty->GetElementProperty(), *reinterpret_cast<const FName*>(SetHelper.GetElementPtr(SetIt)));
+				}
+			}
+		}
+		else if(const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			const bool bNameKey = CastField<FNameProperty>(MapProperty->GetKeyProperty()) != nullptr;
+			const bool bNameValue = CastField<FNameProperty>(MapProperty->GetValueProperty()) != nullptr;
+			if(bNameKey || bNameValue)
+			{
+				FScriptMapHelper MapHelper(MapProperty, ValuePtr);
+				for (FScriptMapHelper::FIterator MapIt(MapHelper); MapIt; ++MapIt)
+				{
+					if(bNameKey)
+					{
+						CountName(MapProperty->GetKeyProperty(), *reinterpret_cast<const FName*>(MapHelper.GetKeyPtr(MapIt)));
+					}
+					if(bNameValue)
+					{
+						CountName(MapProperty->GetValueProperty(), *reinterpret_cast<const FName*>(MapHelper.GetValuePtr(MapIt)));
+					}
+				}
+			}
+		}
+	}
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::ApplyPackageUsage(const FPackageUsage& Usage, int32 Sign)
+{
+	for (const TPair<FSoftObjectPath, TMap<FName, int32>>& SourcePair : Usage)
+	{
+		FSourceUsage& SourceUsage = Sources.FindOrAdd(SourcePair.Key);
+		for (const TPair<FName, int32>& RowPair : SourcePair.Value)
+		{
+			int32& Count = SourceUsage.Counts.FindOrAdd(RowPair.Key);
+			Count += Sign * RowPair.Value;
+			if(Count <= 0)
+			{
+				SourceUsage.Counts.Remove(RowPair.Key);
+			}
+		}
+		SourceUsage.bMostUsedDirty = true;
+	}
+	bDirty |= !Usage.IsEmpty();
+}
+
+FString EasyDataTableRowName::Editor::FRowNameUsageStats::GetStatsFilePath() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("EasyDataTableRowName") / TEXT("RowNameUsage.bin");
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::Load()
+{
+	if(bLoaded)
+	{
+		return;
+	}
+	bLoaded = true;
+
+	TArray<uint8> Bytes;
+	if(!FFileHelper::LoadFileToArray(Bytes, *GetStatsFilePath(), FILEREAD_Silent))
+	{
+		return;
+	}
+	FMemoryReader Reader(Bytes);
+	int32 Version = 0;
+	Reader << Version;
+	if(Version != RowNameUsageFileVersion)
+	{
+		return;
+	}
+
+	TMap<FSoftObjectPath, TArray<FName>> RecentPicks;
+	Reader << Packages;
+	Reader << RecentPicks;
+	if(Reader.IsError())
+	{
+		Packages.Reset();
+		return;
+	}
+
+	for (const TPair<FName, FPackageUsage>& Pair : Packages)
+	{
+		ApplyPackageUsage(Pair.Value, 1);
+	}
+	for (TPair<FSoftObjectPath, TArray<FName>>& Pair : RecentPicks)
+	{
+		Sources.FindOrAdd(Pair.Key).RecentPicks = MoveTemp(Pair.Value);
+	}
+	bDirty = false;
+}
+
+void EasyDataTableRowName::Editor::FRowNameUsageStats::Save() const
+{
+	TMap<FSoftObjectPath, TArray<FName>> RecentPicks;
+	for (const TPair<FSoftObjectPath, FSourceUsage>& Pair : Sources)
+	{
+		if(!Pair.Value.RecentPicks.IsEmpty())
+		{
+			RecentPicks.Add(Pair.Key, Pair.Value.RecentPicks);
+		}
+	}
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	int32 Version = RowNameUsageFileVersion;
+	Writer << Version;
+	// Serialize is not const, the maps are only read
+	Writer << const_cast<TMap<FName, FPackageUsage>&>(Packages);
+	Writer << RecentPicks;
+	FFileHelper::SaveArrayToFile(Bytes, *GetStatsFilePath());
+}
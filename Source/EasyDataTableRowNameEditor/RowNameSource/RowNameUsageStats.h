@@ -0,0 +1,71 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "RowNameSourceProvider.h"
+#include "Containers/Ticker.h"
+
+class UPackage;
+class FObjectPostSaveContext;
+
+namespace EasyDataTableRowName::Editor
+{
+	/**
+	 * How often each row of a source is used by saved assets of the project, plus the rows picked last.
+	 * Counts are kept per package: when a package is saved its tagged FName values are counted again and
+	 * replace what it contributed before, so the totals never need a project scan. A package loaded in the
+	 * editor that was never counted is counted once in the background; assets neither loaded nor saved since
+	 * the plugin was installed are not known. Everything is stored in Saved/EasyDataTableRowName/RowNameUsage.bin,
+	 * written periodically while it has changes and on shutdown.
+	 */
+	class EASYDATATABLEROWNAMEEDITOR_API FRowNameUsageStats
+	{
+		public:
+			static FRowNameUsageStats& Get();
+
+			void Startup();
+			void Shutdown();
+
+			/** Remembers RowName as the latest pick from SourcePath */
+			void RecordPick(const FSoftObjectPath& SourcePath, const FName& RowName);
+
+			/** Recent picks first, newest first, then the most used rows, at most MaxCount without duplicates */
+			void GetPreferredRowNames(const FSoftObjectPath& SourcePath, int32 MaxCount, TArray<FName>& OutRowNames);
+
+		private:
+			struct FSourceUsage
+			{
+				TMap<FName, int32> Counts;
+				TArray<FName> RecentPicks;
+				/** Counts sorted by use, rebuilt on the first request after Counts changed */
+				TArray<FName> MostUsed;
+				bool bMostUsedDirty = true;
+			};
+
+			/** What one package contributes to the counts */
+			using FPackageUsage = TMap<FSoftObjectPath, TMap<FName, int32>>;
+
+			void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+			static void CountPackage(UPackage* Package, FPackageUsage& OutUsage);
+			static void CountObject(const UObject* Object, FPackageUsage& OutUsage);
+			void ApplyPackageUsage(const FPackageUsage& Usage, int32 Sign);
+
+			void OnAssetLoaded(UObject* Asset);
+			bool CountLoadedPackages(float DeltaTime);
+			bool SaveIfDirty(float DeltaTime);
+
+			FString GetStatsFilePath() const;
+			void Load();
+			void Save() const;
+
+			TMap<FSoftObjectPath, FSourceUsage> Sources;
+			TMap<FName, FPackageUsage> Packages;
+			FDelegateHandle PackageSavedHandle;
+			FDelegateHandle AssetLoadedHandle;
+			/** Loaded packages not counted yet, counted a few per frame */
+			TArray<TWeakObjectPtr<UPackage>> PackagesToCount;
+			FTSTicker::FDelegateHandle CountTickHandle;
+			FTSTicker::FDelegateHandle SaveTickHandle;
+			bool bLoaded = false;
+			bool bDirty = false;
+	};
+}
@@ -0,0 +1,45 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EasyRowNameOptionsBatchLibrary.h"
+
+#include "Batch/RowNameOptionsBatch.h"
+
+#define LOCTEXT_NAMESPACE "EasyDataTableRowName"
+
+int32 UEasyRowNameOptionsBatchLibrary::AssignOptionsSources(const TArray<FEasyRowNameOptionsAssignment>& Assignments,
+	bool bCompile)
+{
+	EasyDataTableRowName::Editor::FRowNameOptionsBatch Batch;
+	for (const FEasyRowNameOptionsAssignment& Assignment : Assignments)
+	{
+		Batch.Assign(Assignment.Blueprint, Assignment.VariableName,
+			static_cast<EasyDataTableRowName::Editor::ERowNameOptionsSlot>(Assignment.Slot), Assignment.SourcePath);
+	}
+	if(Batch.GetNumRejected() > 0)
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("AssignOptionsSources: %d assignment(s) name a path that is not a row name source, nothing was changed"),
+			Batch.GetNumRejected()), ELogVerbosity::Error);
+		return -1;
+	}
+	return Batch.Apply(LOCTEXT("AssignOptionsSources", "Assign Row Name Options Sources"), bCompile);
+}
+
+int32 UEasyRowNameOptionsBatchLibrary::RetargetOptionsSources(const TArray<UBlueprint*>& Blueprints,
+	const FSoftObjectPath& OldSourcePath, const FSoftObjectPath& NewSourcePath, bool bCompile)
+{
+	EasyDataTableRowName::Editor::FRowNameOptionsBatch Batch;
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		Batch.Retarget(Blueprint, OldSourcePath, NewSourcePath);
+	}
+	if(Batch.GetNumRejected() > 0)
+	{
+		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("RetargetOptionsSources: %s is not a row name source, nothing was changed"),
+			*NewSourcePath.ToString()), ELogVerbosity::Error);
+		return -1;
+	}
+	return Batch.Apply(LOCTEXT("RetargetOptionsSources", "Retarget Row Name Options Sources"), bCompile);
+}
+
+#undef LOCTEXT_NAMESPACE
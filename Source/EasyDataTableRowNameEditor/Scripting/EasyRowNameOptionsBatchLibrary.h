@@ -0,0 +1,58 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "EasyRowNameOptionsBatchLibrary.generated.h"
+
+class UBlueprint;
+
+/** Mirrors EasyDataTableRowName::Editor::ERowNameOptionsSlot for Blueprint and Python */
+UENUM(BlueprintType)
+enum class EEasyRowNameOptionsSlot : uint8
+{
+	/** OptionsFromXxx of FName, TArray<FName> and TSet<FName> variables */
+	Common,
+	/** KeyOptionsFromXxx of TMap<FName,...> variables */
+	Key,
+	/** ValueOptionsFromXxx of TMap<...,FName> variables */
+	Value,
+};
+
+USTRUCT(BlueprintType)
+struct FEasyRowNameOptionsAssignment
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EasyDataTableRowName")
+	TObjectPtr<UBlueprint> Blueprint = nullptr;
+
+	/** None assigns every variable of the Blueprint that fits Slot */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EasyDataTableRowName")
+	FName VariableName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EasyDataTableRowName")
+	EEasyRowNameOptionsSlot Slot = EEasyRowNameOptionsSlot::Common;
+
+	/** DataTable, CurveTable or StringTable to pick names from, empty clears the slot */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EasyDataTableRowName", meta = (AllowedClasses = "/Script/Engine.DataTable,/Script/Engine.CurveTable,/Script/Engine.StringTable"))
+	FSoftObjectPath SourcePath;
+};
+
+/**
+ * Bulk editing of OptionsFromXxx metadata on Blueprint variables.
+ * All changes of one call share one transaction, and every Blueprint is modified and compiled once.
+ */
+UCLASS()
+class EASYDATATABLEROWNAMEEDITOR_API UEasyRowNameOptionsBatchLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Applies every assignment, returns the number of variables changed, -1 without changes when a SourcePath is not a row name source */
+	UFUNCTION(BlueprintCallable, Category = "EasyDataTableRowName|Batch", meta = (DevelopmentOnly))
+	static int32 AssignOptionsSources(const TArray<FEasyRowNameOptionsAssignment>& Assignments, bool bCompile = true);
+
+	/** Points every variable of Blueprints using OldSourcePath at NewSourcePath, returns the number of variables changed, -1 when NewSourcePath is not a row name source */
+	UFUNCTION(BlueprintCallable, Category = "EasyDataTableRowName|Batch", meta = (DevelopmentOnly))
+	static int32 RetargetOptionsSources(const TArray<UBlueprint*>& Blueprints, const FSoftObjectPath& OldSourcePath, const FSoftObjectPath& NewSourcePath, bool bCompile = true);
+};
@@ -0,0 +1,233 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "EasyRowNameQueryLibrary.h"
+
+#include "ScopedTransaction.h"
+#include "RowNameSource/RowNameIndexCache.h"
+
+#define LOCTEXT_NAMESPACE "EasyDataTableRowName"
+
+FEasyRowNameSource UEasyRowNameQueryLibrary::ResolvePropertySource(const UStruct* Struct, FName PropertyName,
+	EEasyRowNameOptionsSlot Slot)
+{
+	const FProperty* Property = Struct != nullptr ? FindFProperty<FProperty>(Struct, PropertyName) : nullptr;
+	return ToScriptSource(EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::Get().FindSourceMetaData(Property,
+		static_cast<EasyDataTableRowName::Editor::ERowNameOptionsSlot>(Slot)));
+}
+
+FEasyRowNameSource UEasyRowNameQueryLibrary::ResolveObjectPropertySource(const UObject* Object, FName PropertyName,
+	EEasyRowNameOptionsSlot Slot)
+{
+	if(Object == nullptr)
+	{
+		return FEasyRowNameSource();
+	}
+
+	const FProperty* Property = FindFProperty<FProperty>(Object->GetClass(), PropertyName);
+	EasyDataTableRowName::Editor::FRowNameSourceRef Source = EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::Get().FindSourceMetaData(
+		Property, static_cast<EasyDataTableRowName::Editor::ERowNameOptionsSlot>(Slot));
+	if(Source.IsDynamic())
+	{
+		const FObjectPropertyBase* SourceProperty = FindFProperty<FObjectPropertyBase>(Object->GetClass(), Source.SourcePropertyName);
+		Source.SourcePath = SourceProperty != nullptr
+			? FSoftObjectPath(SourceProperty->GetObjectPropertyValue_InContainer(Object))
+			: FSoftObjectPath();
+	}
+	return ToScriptSource(Source);
+}
+
+bool UEasyRowNameQueryLibrary::ContainsRowName(const FEasyRowNameSource& Source, FName RowName)
+{
+	const TSharedPtr<const EasyDataTableRowName::Editor::FRowNameIndex> Index = LoadIndex(Source);
+	return Index.IsValid() ? Index->Contains(RowName) : RowName.IsNone();
+}
+
+TArray<FName> UEasyRowNameQueryLibrary::GetRowNames(const FEasyRowNameSource& Source)
+{
+	TArray<FName> RowNames;
+	if(const TSharedPtr<const EasyDataTableRowName::Editor::FRowNameIndex> Index = LoadIndex(Source))
+	{
+		RowNames.Reserve(Index->Num() - 1);
+		// Item 0 is the NAME_None entry of the picker
+		for (int32 ItemIndex = 1; ItemIndex < Index->Num(); ++ItemIndex)
+		{
+			RowNames.Add(*Index->GetItems()[ItemIndex]);
+		}
+	}
+	return RowNames;
+}
+
+TArray<FName> UEasyRowNameQueryLibrary::SearchRowNames(const FEasyRowNameSource& Source, const FString& SearchText)
+{
+	TArray<FName> RowNames;
+	if(const TSharedPtr<const EasyDataTableRowName::Editor::FRowNameIndex> Index = LoadIndex(Source))
+	{
+		TArray<TSharedPtr<FName>> Items;
+		Index->Filter(SearchText, Items);
+		RowNames.Reserve(Items.Num());
+		for (const TSharedPtr<FName>& Item : Items)
+		{
+			if(!Item->IsNone())
+			{
+				RowNames.Add(*Item);
+			}
+		}
+	}
+	return RowNames;
+}
+
+TArray<FName> UEasyRowNameQueryLibrary::FindSimilarRowNames(const FEasyRowNameSource& Source, const FString& Text,
+	int32 MaxDistance, int32 MaxResults)
+{
+	TArray<FName> RowNames;
+	if(const TSharedPtr<const EasyDataTableRowName::Editor::FRowNameIndex> Index = LoadIndex(Source))
+	{
+		Index->FindSimilar(Text, MaxDistance, MaxResults, RowNames);
+	}
+	return RowNames;
+}
+
+int32 UEasyRowNameQueryLibrary::SetRowNameValues(const TArray<UObject*>& Objects, FName PropertyName,
+	const TArray<FName>& Values, bool bSkipInvalid)
+{
+	if(Values.IsEmpty() || (Values.Num() != 1 && Values.Num() != Objects.Num()))
+	{
+		return 0;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("SetRowNameValues", "Set Row Name Values"));
+	int32 NumChanged = 0;
+	for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ++ObjectIndex)
+	{
+		UObject* Object = Objects[ObjectIndex];
+		FNameProperty* Property = IsValid(Object) ? FindFProperty<FNameProperty>(Object->GetClass(), PropertyName) : nullptr;
+		if(Property == nullptr)
+		{
+			continue;
+		}
+
+		const FName& Value = Values.Num() == 1 ? Values[0] : Values[ObjectIndex];
+		FName& CurrentValue = *Property->ContainerPtrToValuePtr<FName>(Object);
+		if(CurrentValue == Value)
+		{
+			continue;
+		}
+		// Indexes are shared through the cache, only the first object of a table pays for it
+		if(bSkipInvalid && !ContainsRowName(ResolveObjectPropertySource(Object, PropertyName), Value))
+		{
+			continue;
+		}
+
+		Object->Modify();
+		Object->PreEditChange(Property);
+		CurrentValue = Value;
+		FPropertyChangedEvent ChangedEvent(Property, EPropertyChangeType::ValueSet);
+		Object->PostEditChangeProperty(ChangedEvent);
+		++NumChanged;
+	}
+	return NumChanged;
+}
+
+int32 UEasyRowNameQueryLibrary::RemapRowNameValues(const TArray<UObject*>& Objects, FName PropertyName,
+	const TMap<FName, FName>& Remap)
+{
+	if(Remap.IsEmpty())
+	{
+		return 0;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("RemapRowNameValues", "Remap Row Name Values"));
+	int32 NumChanged = 0;
+	for (UObject* Object : Objects)
+	{
+		FProperty* Property = IsValid(Object) ? FindFProperty<FProperty>(Object->GetClass(), PropertyName) : nullptr;
+		if(Property == nullptr)
+		{
+			continue;
+		}
+
+		// Names are collected first so untouched objects stay out of the transaction
+		TArray<FName*> NamesToRemap;
+		void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Object);
+		const FSetProperty* SetProperty = CastField<FSetProperty>(Property);
+		if(CastField<FNameProperty>(Property))
+		{
+			NamesToRemap.Add(static_cast<FName*>(ValuePtr));
+		}
+		else if(const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			if(CastField<FNameProperty>(ArrayProperty->Inner))
+			{
+				FScriptArrayHelper ArrayHelper(ArrayProperty, ValuePtr);
+				for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+				{
+					NamesToRemap.Add(reinterpret_cast<FName*>(ArrayHelper.GetRawPtr(Index)));
+				}
+			}
+		}
+		else if(SetProperty != nullptr && CastField<FNameProperty>(SetProperty->GetElementProperty()))
+		{
+			FScriptSetHelper SetHelper(SetProperty, ValuePtr);
+			for (FScriptSetHelper::FIterator It(SetHelper); It; ++It)
+			{
+				NamesToRemap.Add(reinterpret_cast<FName*>(SetHelper.GetElementPtr(It)));
+			}
+		}
+		NamesToRemap.RemoveAll([&Remap](const FName* Name) { return !Remap.Contains(*Name); });
+		if(NamesToRemap.IsEmpty())
+		{
+			continue;
+		}
+
+		Object->Modify();
+		Object->PreEditChange(Property);
+		for (FName* Name : NamesToRemap)
+		{
+			*Name = Remap.FindChecked(*Name);
+		}
+		if(SetProperty != nullptr)
+		{
+			FScriptSetHelper(SetProperty, ValuePtr).Rehash();
+		}
+		FPropertyChangedEvent ChangedEvent(Property, EPropertyChangeType::ValueSet);
+		Object->PostEditChangeProperty(ChangedEvent);
+		++NumChanged;
+	}
+	return NumChanged;
+}
+
+FEasyRowNameSource UEasyRowNameQueryLibrary::ToScriptSource(const EasyDataTableRowName::Editor::FRowNameSourceRef& Source)
+{
+	FEasyRowNameSource ScriptSource;
+	if(Source.Provider.IsValid())
+	{
+		ScriptSource.SourcePath = Source.SourcePath;
+		ScriptSource.RowFilter = Source.RowFilter;
+		ScriptSource.DisplayField = Source.DisplayField;
+	}
+	return ScriptSource;
+}
+
+TSharedPtr<const EasyDataTableRowName::Editor::FRowNameIndex> UEasyRowNameQueryLibrary::LoadIndex(
+	const FEasyRowNameSource& Source)
+{
+	EasyDataTableRowName::Editor::FRowNameSourceRef SourceRef;
+	SourceRef.Provider = EasyDataTableRowName::Editor::FRowNameSourceProviderRegistry::Get().FindProviderForPath(Source.SourcePath);
+	SourceRef.SourcePath = Source.SourcePath;
+	SourceRef.RowFilter = Source.RowFilter;
+	SourceRef.DisplayField = Source.DisplayField;
+	if(!SourceRef.IsValid())
+	{
+		return nullptr;
+	}
+
+	EasyDataTableRowName::Editor::FRowNameIndexCache& Cache = EasyDataTableRowName::Editor::FRowNameIndexCache::Get();
+	if(Cache.ResolveSourceObject(SourceRef) == nullptr)
+	{
+		Source.SourcePath.TryLoad();
+	}
+	return Cache.FindOrBuildIndex(SourceRef);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,83 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyRowNameOptionsBatchLibrary.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "EasyRowNameQueryLibrary.generated.h"
+
+namespace EasyDataTableRowName::Editor
+{
+	class FRowNameIndex;
+	struct FRowNameSourceRef;
+}
+
+/** Where a tagged property picks its names from, as the details panel resolves it */
+USTRUCT(BlueprintType)
+struct FEasyRowNameSource
+{
+	GENERATED_BODY()
+
+	/** Empty when the property has no row name metadata, or its OptionsFromProperty sibling is not set */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EasyDataTableRowName")
+	FSoftObjectPath SourcePath;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EasyDataTableRowName")
+	FString RowFilter;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EasyDataTableRowName")
+	FString DisplayField;
+};
+
+/**
+ * Row name queries for editor scripts, answered from the same shared indexes as the pickers.
+ * A source is loaded on first use only, later calls reuse its cached index until the table changes.
+ */
+UCLASS()
+class EASYDATATABLEROWNAMEEDITOR_API UEasyRowNameQueryLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Source of PropertyName declared on Struct, OptionsFromProperty sources need an object, see ResolveObjectPropertySource */
+	UFUNCTION(BlueprintCallable, Category = "EasyDataTableRowName|Query", meta = (DevelopmentOnly))
+	static FEasyRowNameSource ResolvePropertySource(const UStruct* Struct, FName PropertyName, EEasyRowNameOptionsSlot Slot = EEasyRowNameOptionsSlot::Common);
+
+	/** Source of PropertyName on Object, reading the OptionsFromProperty sibling of that object when needed */
+	UFUNCTION(BlueprintCallable, Category = "EasyDataTableRowName|Query", meta = (DevelopmentOnly))
+	static FEasyRowNameSource ResolveObjectPropertySource(const UObject* Object, FName PropertyName, EEasyRowNameOptionsSlot Slot = EEasyRowNameOptionsSlot::Common);
+
+	/** Whether RowName would be listed by a picker of Source, None always is */
+	UFUNCTION(BlueprintCallable, Category = "EasyDataTableRowName|Query", meta = (DevelopmentOnly))
+	static bool ContainsRowName(const FEasyRowNameSource& Source, FName RowName);
+
+	UFUNCTION(BlueprintCallable, Category = "EasyDataTableRowName|Query", meta = (DevelopmentOnly))
+	static TArray<FName> GetRowNames(const FEasyRowNameSource& Source);
+
+	/** Row names whose name or display field contains SearchText, ignoring case */
+	UFUNCTION(BlueprintCallable, Category = "EasyDataTableRowName|Query", meta = (DevelopmentOnly))
+	static TArray<FName> SearchRowNames(const FEasyRowNameSource& Source, const FString& SearchText);
+
+	/** Row names within MaxDistance edits of Text, closest first, MaxResults 0 returns them all */
+	UFUNCTION(BlueprintCallable, Category = "EasyDataTableRowName|Query", meta = (DevelopmentOnly))
+	static TArray<FName> FindSimilarRowNames(const FEasyRowNameSource& Source, const FString& Text, int32 MaxDistance = 3, int32 MaxResults = 5);
+
+	/**
+	 * Sets the FName PropertyName of Objects[i] to Values[i], or of every object to Values[0] when only one value is given.
+	 * With bSkipInvalid, values its picker would not list are left out. Returns the number of objects changed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EasyDataTableRowName|Batch", meta = (DevelopmentOnly))
+	static int32 SetRowNameValues(const TArray<UObject*>& Objects, FName PropertyName, const TArray<FName>& Values, bool bSkipInvalid = true);
+
+	/**
+	 * Replaces names found in Remap in the FName, TArray<FName> or TSet<FName> PropertyName of every object.
+	 * Returns the number of objects changed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EasyDataTableRowName|Batch", meta = (DevelopmentOnly))
+	static int32 RemapRowNameValues(const TArray<UObject*>& Objects, FName PropertyName, const TMap<FName, FName>& Remap);
+
+private:
+	static FEasyRowNameSource ToScriptSource(const EasyDataTableRowName::Editor::FRowNameSourceRef& Source);
+
+	/** Index of Source, loading the asset when nothing has loaded it yet */
+	static TSharedPtr<const EasyDataTableRowName::Editor::FRowNameIndex> LoadIndex(const FEasyRowNameSource& Source);
+};
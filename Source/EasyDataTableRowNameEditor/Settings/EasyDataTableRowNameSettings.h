@@ -0,0 +1,66 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "Engine/DeveloperSettings.h"
+#include "EasyDataTableRowNameSettings.generated.h"
+
+/** Editor Preferences > Plugins > Easy DataTable Row Name */
+UCLASS(config = EditorPerProjectUserSettings, meta = (DisplayName = "Easy DataTable Row Name"))
+class EASYDATATABLEROWNAMEEDITOR_API UEasyDataTableRowNameSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UEasyDataTableRowNameSettings();
+
+	virtual FName GetContainerName() const override { return TEXT("Editor"); }
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+
+	/**
+	 * Once the asset registry finished scanning, load the sources referenced by row name metadata
+	 * of native classes, native structs and Blueprints, and build their name indexes on low priority
+	 * worker threads, so the first picker opened does not pay for it. Blueprints are found through a tag
+	 * written on save, ones saved before the plugin version that added it are missed until resaved.
+	 * Tables loaded this way stay loaded until Row Name Cache Budget drops their index.
+	 * Takes a share of every frame after startup, so it is off unless asked for.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Prewarm")
+	bool bPrewarmRowNameIndexes = false;
+
+	/** Upper bound of source packages requested per frame while prewarming */
+	UPROPERTY(config, EditAnywhere, Category = "Prewarm", meta = (ClampMin = "1", EditCondition = "bPrewarmRowNameIndexes"))
+	int32 PrewarmLoadsPerFrame = 4;
+
+	/**
+	 * Memory the cached row name indexes may hold together, least recently used tables are dropped beyond it.
+	 * 0 keeps every table. EasyDataTableRowName.DumpMemory lists what is held.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Memory", meta = (ClampMin = "0", Units = "Megabytes"))
+	int32 RowNameCacheBudgetMB = 256;
+
+	/**
+	 * With an empty search, list the rows picked last and the rows most used by saved assets of the project
+	 * at the top of the picker, the remaining rows follow in table order.
+	 * Usage is counted from assets saved or loaded in the editor since the plugin was installed,
+	 * on an existing project the list fills as assets are opened and saved.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Ordering")
+	bool bOrderRowsByUsage = false;
+
+	/** How many rows are moved to the top, recent picks included */
+	UPROPERTY(config, EditAnywhere, Category = "Ordering", meta = (ClampMin = "1", EditCondition = "bOrderRowsByUsage"))
+	int32 UsageTopRowCount = 20;
+
+	/** How many picks are remembered per source */
+	UPROPERTY(config, EditAnywhere, Category = "Ordering", meta = (ClampMin = "0", EditCondition = "bOrderRowsByUsage"))
+	int32 RecentRowPickCount = 5;
+
+	/** Where row name headers are generated, Source/<Project>/EasyRowNames when empty */
+	UPROPERTY(config, EditAnywhere, Category = "Code Generation", meta = (RelativeToGameDir))
+	FDirectoryPath RowNameHeaderDirectory;
+
+	/** Tables the EasyRowNameCodeGen commandlet generates headers for when no -Tables= is given */
+	UPROPERTY(config, EditAnywhere, Category = "Code Generation")
+	TArray<TSoftObjectPtr<UDataTable>> RowNameHeaderTables;
+};